@@ -37,10 +37,26 @@ public:
 
 protected:
   void addKernels();
+  void addElementKernel();
   void addMaterial();
+  void checkCoordSystem();
+  void addNearNullSpace();
+  void addMatrixFreeTangent();
+  void addPreconditioner();
+  void addSplits();
+  void addErosionNodalKernels();
 
   const static std::vector< std::string > excludedParameters;
 
   const unsigned int _ndisp;
   const unsigned int _nmrot;
+
+  /// The planar formulation: none, plane_strain or axisymmetric
+  const MooseEnum _planar_formulation;
+  /// Plane strain or axisymmetric, with 2 displacements and the micro rotation about the
+  /// out-of-plane axis
+  const bool _planar;
+
+  /// The automatic preconditioning of the coupled system
+  const MooseEnum _preconditioning;
 };
@@ -0,0 +1,50 @@
+/* ---------------------------------------------------------------------
+ *       _                           _
+ *   ___| |__   __ _ _ __ ___   ___ (_)___
+ *  / __| '_ \ / _` | '_ ` _ \ / _ \| / __|
+ * | (__| | | | (_| | | | | | | (_) | \__ \
+ *  \___|_| |_|\__,_|_| |_| |_|\___/|_|___/
+ *
+ * Chamois - a MOOSE interface to constitutive models developed at the
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of chamois.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "Action.h"
+
+/**
+ * Sets up the IndirectDisplacementControlScalarKernel and, optionally, a bordered solve of the
+ * resulting system by a Schur complement field split, which keeps the dense row and column of the
+ * load parameter out of the preconditioner of the mechanical block.
+ */
+class IndirectDisplacementControlAction : public Action
+{
+public:
+  static InputParameters validParams();
+
+  IndirectDisplacementControlAction( const InputParameters & params );
+
+  void act();
+
+protected:
+  void addScalarKernel();
+  void addPreconditioner();
+  void addSplits();
+
+  const NonlinearVariableName _load_parameter;
+  const bool _bordered_solve;
+};
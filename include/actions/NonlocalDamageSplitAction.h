@@ -0,0 +1,49 @@
+/* ---------------------------------------------------------------------
+ *       _                           _
+ *   ___| |__   __ _ _ __ ___   ___ (_)___
+ *  / __| '_ \ / _` | '_ ` _ \ / _ \| / __|
+ * | (__| | | | (_| | | | | | | (_) | \__ \
+ *  \___|_| |_|\__,_|_| |_| |_|\___/|_|___/
+ *
+ * Chamois - a MOOSE interface to constitutive models developed at the
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of chamois.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "Action.h"
+
+/**
+ * Sets up an operator split of the nonlocal damage field from the mechanical fields by a field
+ * split preconditioner. The Helmholtz operator of the implicit gradient enhancement does not change
+ * for a constant nonlocal radius, so the preconditioner of the damage block is set up once and
+ * reused across nonlinear iterations and time steps.
+ */
+class NonlocalDamageSplitAction : public Action
+{
+public:
+  static InputParameters validParams();
+
+  NonlocalDamageSplitAction( const InputParameters & params );
+
+  void act();
+
+protected:
+  void addPreconditioner();
+  void addSplits();
+
+  const NonlinearVariableName _nonlocal_damage;
+};
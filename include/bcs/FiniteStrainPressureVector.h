@@ -0,0 +1,82 @@
+/* ---------------------------------------------------------------------
+ *       _                           _
+ *   ___| |__   __ _ _ __ ___   ___ (_)___
+ *  / __| '_ \ / _` | '_ ` _ \ / _ \| / __|
+ * | (__| | | | (_| | | | | | | (_) | \__ \
+ *  \___|_| |_|\__,_|_| |_| |_|\___/|_|___/
+ *
+ * Chamois - a MOOSE interface to constitutive models developed at the
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of chamois.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "DerivativeMaterialInterface.h"
+#include "IntegratedBC.h"
+
+#include "FastorHelper.h"
+
+class Function;
+
+/**
+ * FiniteStrainPressureVector applies a follower pressure on a given boundary to all three
+ * displacement components at once. The pressure and its linearization are evaluated once per
+ * quadrature point, and the residuals and Jacobian blocks of all components are assembled
+ * together. The BC acts on the first displacement component.
+ */
+class FiniteStrainPressureVector : public DerivativeMaterialInterface< IntegratedBC >
+{
+public:
+  static InputParameters validParams();
+
+  FiniteStrainPressureVector( const InputParameters & parameters );
+
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+  virtual void computeOffDiagJacobian( unsigned int jvar ) override;
+  virtual void computeOffDiagJacobianScalar( unsigned int jvar ) override;
+
+protected:
+  /// Unused, the residual is computed for all components at once
+  virtual Real computeQpResidual() override { return 0.0; }
+
+  /// The pressure magnitude at the current quadrature point, without the load parameter
+  Real computeQpPressure();
+
+  Real getAmplification();
+
+  const Function * const _function;
+
+  const PostprocessorValue * const _postprocessor;
+
+  /// _alpha Parameter for HHT time integration scheme
+  const Real _alpha;
+
+  /// coupled displacement variables
+  std::vector< unsigned int > _dvars;
+
+  const unsigned int _lambda_var;
+
+  const VariableValue * const _lambda_value;
+
+  const MaterialProperty< Tensor3R > & _n;
+
+  const MaterialProperty< Tensor333R > & _dn_dF;
+
+  /// Local residual vectors and Jacobian blocks of all components
+  std::vector< DenseVector< Number > > _element_re;
+  std::vector< DenseMatrix< Number > > _element_ke;
+};
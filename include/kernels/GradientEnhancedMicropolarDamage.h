@@ -26,20 +26,26 @@
 
 #include "DerivativeMaterialInterface.h"
 #include "Kernel.h"
+#include "MarmotErodibleKernel.h"
 #include "FastorHelper.h"
+#include "GradientEnhancedMicropolarModuli.h"
+#include "MicropolarHoop.h"
 
 // Forward Declarations
 
 /**
  * Computes the classical 2.o Helmholtz like equation for nonlocal damage
  */
-class GradientEnhancedMicropolarDamage : public DerivativeMaterialInterface< Kernel >
+class GradientEnhancedMicropolarDamage
+  : public MarmotErodibleKernel< DerivativeMaterialInterface< Kernel > >
 {
 public:
   static InputParameters validParams();
 
   GradientEnhancedMicropolarDamage( const InputParameters & parameters );
 
+  virtual void initialSetup() override;
+
 protected:
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
@@ -49,16 +55,48 @@ protected:
   Real computeQpJacobianMicroRotation( unsigned int comp_j );
   Real computeQpJacobianNonlocalDamage();
 
+  /// Derivatives at the current quadrature point, from the element scratch storage or properties
+  const Tensor33R & dk_local_dF() const
+  {
+    return _element_moduli ? ( *_element_moduli )[_qp].dk_local_dF : ( *_dk_local_dF )[_qp];
+  }
+  const Tensor3R & dk_local_dw() const
+  {
+    return _element_moduli ? ( *_element_moduli )[_qp].dk_local_dw : ( *_dk_local_dw )[_qp];
+  }
+  const Tensor33R & dk_local_dgrad_w() const
+  {
+    return _element_moduli ? ( *_element_moduli )[_qp].dk_local_dgrad_w
+                           : ( *_dk_local_dgrad_w )[_qp];
+  }
+  const Real & dk_local_dk() const
+  {
+    return _element_moduli ? ( *_element_moduli )[_qp].dk_local_dk : ( *_dk_local_dk )[_qp];
+  }
+
+  /// The component of the j-th coupled micro rotation; for plane strain, the single micro
+  /// rotation is the rotation about the out-of-plane axis
+  unsigned int mrotComponent( unsigned int j ) const { return _nmrot == 1 ? 2 : j; }
+
+  /// The hoop term of the trial function of the component c for the axisymmetric formulation
+  Real hoopPhi( unsigned int c ) const
+  {
+    return MicropolarHoop::factor( c ) * _phi[_j][_qp] / _q_point[_qp]( 0 );
+  }
+
   /// Base name of the material system that this kernel applies to
   const std::string _base_name;
 
   const MaterialProperty< Real > & _k_local;
   const MaterialProperty< Real > & _nonlocal_radius;
   /// Derivatives of the w.r.t. deformation gradient, micro rotations, material gradient of the micro rotations and the nonlocal damage driving field
-  const MaterialProperty< Tensor33R > & _dk_local_dF;
-  const MaterialProperty< Tensor3R > & _dk_local_dw;
-  const MaterialProperty< Tensor33R > & _dk_local_dgrad_w;
-  const MaterialProperty< Real > & _dk_local_dk;
+  const MaterialProperty< Tensor33R > * _dk_local_dF;
+  const MaterialProperty< Tensor3R > * _dk_local_dw;
+  const MaterialProperty< Tensor33R > * _dk_local_dgrad_w;
+  const MaterialProperty< Real > * _dk_local_dk;
+
+  /// The element scratch storage of the moduli, if the material keeps them there
+  const std::vector< GradientEnhancedMicropolarModuli > * _element_moduli;
 
   /// Coupled displacement variables
   unsigned int _ndisp;
@@ -72,4 +110,7 @@ protected:
 
   /// The MOOSE variable number of the nonlocal damage variable
   unsigned int _nonlocal_damage_var;
+
+  /// Axisymmetric formulation with the hoop terms of the RZ coordinate system
+  bool _axisymmetric;
 };
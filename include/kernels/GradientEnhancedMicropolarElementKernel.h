@@ -0,0 +1,108 @@
+/* ---------------------------------------------------------------------
+ *       _                           _
+ *   ___| |__   __ _ _ __ ___   ___ (_)___
+ *  / __| '_ \ / _` | '_ ` _ \ / _ \| / __|
+ * | (__| | | | (_| | | | | | | (_) | \__ \
+ *  \___|_| |_|\__,_|_| |_| |_|\___/|_|___/
+ *
+ * Chamois - a MOOSE interface to constitutive models developed at the
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of chamois.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "Kernel.h"
+#include "MarmotErodibleKernel.h"
+#include "FastorHelper.h"
+#include "GradientEnhancedMicropolarModuli.h"
+
+class MicropolarMatrixFreeTangent;
+
+/**
+ * Computes the complete element residual and Jacobian of the gradient-enhanced micropolar
+ * continuum, i.e., the balance of linear momentum, the balance of angular momentum and the
+ * Helmholtz like equation for nonlocal damage, for all 7 fields in a single pass.
+ * The kernel acts on the first displacement component and assembles the blocks of all other
+ * fields directly. All fields must share the same finite element type.
+ */
+class GradientEnhancedMicropolarElementKernel : public MarmotErodibleKernel< Kernel >
+{
+public:
+  static InputParameters validParams();
+
+  GradientEnhancedMicropolarElementKernel( const InputParameters & parameters );
+
+  virtual void initialSetup() override;
+
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+  virtual void computeOffDiagJacobian( unsigned int jvar ) override;
+
+protected:
+  /// Unused, the element residual is computed as a whole
+  virtual Real computeQpResidual() override { return 0.0; }
+
+  /// Add grad_test_i . ( A . grad_phi_j ) to a local Jacobian block
+  void addGradTestGradPhi( DenseMatrix< Number > & ke, const RealTensorValue & A, Real factor );
+  /// Add ( grad_test_i . a ) phi_j to a local Jacobian block
+  void addGradTestPhi( DenseMatrix< Number > & ke, const RealVectorValue & a, Real factor );
+  /// Add test_i ( a . grad_phi_j ) to a local Jacobian block
+  void addTestGradPhi( DenseMatrix< Number > & ke, const RealVectorValue & a, Real factor );
+  /// Add test_i phi_j to a local Jacobian block
+  void addTestPhi( DenseMatrix< Number > & ke, Real factor );
+
+  /// Record the element data for the matrix-free application of the unassembled blocks
+  void recordMatrixFreeTangent();
+
+  /// The local Jacobian block of the fields a and b
+  DenseMatrix< Number > & keBlock( unsigned int a, unsigned int b )
+  {
+    return _element_ke[a * _n_fields + b];
+  }
+
+  /// The number of fields: 3 displacements, 3 micro rotations and the nonlocal damage
+  static constexpr unsigned int _n_fields = 7;
+
+  /// Base name of the material system that this kernel applies to
+  const std::string _base_name;
+
+  const MaterialProperty< Tensor33R > & _pk_i_stress;
+  const MaterialProperty< Tensor33R > & _pk_i_couple_stress;
+  const MaterialProperty< Tensor3R > & _kirchhoff_moment;
+  const MaterialProperty< Real > & _k_local;
+  const MaterialProperty< Real > & _nonlocal_radius;
+
+  /// The element scratch storage of the moduli of the micropolar material
+  const std::vector< GradientEnhancedMicropolarModuli > * _element_moduli;
+
+  /// The optional matrix-free application of the blocks, which are not assembled
+  const MicropolarMatrixFreeTangent * const _matrix_free_tangent;
+
+  /// The nonlocal damage field
+  const VariableValue & _nonlocal_damage;
+  const VariableGradient & _grad_nonlocal_damage;
+
+  /// The MOOSE variable numbers of all fields, in the order displacements, micro rotations, damage
+  std::vector< unsigned int > _field_var;
+
+  /// Local residual vectors and Jacobian blocks of all fields
+  std::vector< DenseVector< Number > > _element_re;
+  std::vector< DenseMatrix< Number > > _element_ke;
+
+  /// Scratch storage for contractions with the shape function gradients
+  std::vector< RealVectorValue > _contracted_grad_phi;
+  std::vector< Real > _contracted_phi;
+};
@@ -26,7 +26,10 @@
 
 #include "DerivativeMaterialInterface.h"
 #include "Kernel.h"
+#include "MarmotErodibleKernel.h"
 #include "FastorHelper.h"
+#include "GradientEnhancedMicropolarModuli.h"
+#include "MicropolarHoop.h"
 
 // Forward Declarations
 
@@ -34,13 +37,16 @@
  * Computes the contribution of the (nonsymmetric) kirchhoff stress tensor
  * to the balane of angular momentum in the context of the micropolar continuum
  */
-class GradientEnhancedMicropolarKirchhoffMoment : public DerivativeMaterialInterface< Kernel >
+class GradientEnhancedMicropolarKirchhoffMoment
+  : public MarmotErodibleKernel< DerivativeMaterialInterface< Kernel > >
 {
 public:
   static InputParameters validParams();
 
   GradientEnhancedMicropolarKirchhoffMoment( const InputParameters & parameters );
 
+  virtual void initialSetup() override;
+
 protected:
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
@@ -50,6 +56,38 @@ protected:
   Real computeQpJacobianMicroRotation( unsigned int comp_i, unsigned int comp_j );
   Real computeQpJacobianNonlocalDamage( unsigned int comp_i );
 
+  /// Derivatives at the current quadrature point, from the element scratch storage or properties
+  const Tensor333R & dkirchhoff_moment_dF() const
+  {
+    return _element_moduli ? ( *_element_moduli )[_qp].dkirchhoff_moment_dF
+                           : ( *_dkirchhoff_moment_dF )[_qp];
+  }
+  const Tensor33R & dkirchhoff_moment_dw() const
+  {
+    return _element_moduli ? ( *_element_moduli )[_qp].dkirchhoff_moment_dw
+                           : ( *_dkirchhoff_moment_dw )[_qp];
+  }
+  const Tensor333R & dkirchhoff_moment_dgrad_w() const
+  {
+    return _element_moduli ? ( *_element_moduli )[_qp].dkirchhoff_moment_dgrad_w
+                           : ( *_dkirchhoff_moment_dgrad_w )[_qp];
+  }
+  const Tensor3R & dkirchhoff_moment_dk() const
+  {
+    return _element_moduli ? ( *_element_moduli )[_qp].dkirchhoff_moment_dk
+                           : ( *_dkirchhoff_moment_dk )[_qp];
+  }
+
+  /// The component of the j-th coupled micro rotation; for plane strain, the single micro
+  /// rotation is the rotation about the out-of-plane axis
+  unsigned int mrotComponent( unsigned int j ) const { return _nmrot == 1 ? 2 : j; }
+
+  /// The hoop term of the trial function of the component c for the axisymmetric formulation
+  Real hoopPhi( unsigned int c ) const
+  {
+    return MicropolarHoop::factor( c ) * _phi[_j][_qp] / _q_point[_qp]( 0 );
+  }
+
   /// Base name of the material system that this kernel applies to
   const std::string _base_name;
   /// Tensor of which the moment is computed
@@ -58,10 +96,13 @@ protected:
   const MaterialProperty< Tensor3R > & _kirchhoff_moment;
 
   //// Derivatives of the w.r.t. deformation gradient, micro rotations, material gradient of the micro rotations and the nonlocal damage driving field
-  const MaterialProperty< Tensor333R > & _dkirchhoff_moment_dF;
-  const MaterialProperty< Tensor33R > & _dkirchhoff_moment_dw;
-  const MaterialProperty< Tensor333R > & _dkirchhoff_moment_dgrad_w;
-  const MaterialProperty< Tensor3R > & _dkirchhoff_moment_dk;
+  const MaterialProperty< Tensor333R > * _dkirchhoff_moment_dF;
+  const MaterialProperty< Tensor33R > * _dkirchhoff_moment_dw;
+  const MaterialProperty< Tensor333R > * _dkirchhoff_moment_dgrad_w;
+  const MaterialProperty< Tensor3R > * _dkirchhoff_moment_dk;
+
+  /// The element scratch storage of the moduli, if the material keeps them there
+  const std::vector< GradientEnhancedMicropolarModuli > * _element_moduli;
 
   /// An integer corresponding to the direction this kernel acts in
   const unsigned int _component;
@@ -78,4 +119,7 @@ protected:
 
   /// The MOOSE variable number of the nonlocal damage variable
   unsigned int _nonlocal_damage_var;
+
+  /// Axisymmetric formulation with the hoop terms of the RZ coordinate system
+  bool _axisymmetric;
 };
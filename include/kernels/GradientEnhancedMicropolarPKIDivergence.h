@@ -26,7 +26,10 @@
 
 #include "DerivativeMaterialInterface.h"
 #include "Kernel.h"
+#include "MarmotErodibleKernel.h"
 #include "FastorHelper.h"
+#include "GradientEnhancedMicropolarModuli.h"
+#include "MicropolarHoop.h"
 
 // Forward Declarations
 
@@ -35,13 +38,16 @@
  * e.g, for the linear momentum equation (PKI stress) or
  * the angular momentum equation (nominal couple stress tensor)
  */
-class GradientEnhancedMicropolarPKIDivergence : public DerivativeMaterialInterface< Kernel >
+class GradientEnhancedMicropolarPKIDivergence
+  : public MarmotErodibleKernel< DerivativeMaterialInterface< Kernel > >
 {
 public:
   static InputParameters validParams();
 
   GradientEnhancedMicropolarPKIDivergence( const InputParameters & parameters );
 
+  virtual void initialSetup() override;
+
 protected:
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
@@ -51,6 +57,44 @@ protected:
   Real computeQpJacobianMicroRotation( unsigned int comp_i, unsigned int comp_j );
   Real computeQpJacobianNonlocalDamage( unsigned int comp_i );
 
+  /// Derivative of the component ( K, comp_i ) of the tensor w.r.t. the trial function of the
+  /// displacement and micro rotation component comp_j
+  Real dpk_i_du_phi( unsigned int K, unsigned int comp_i, unsigned int comp_j ) const;
+  Real dpk_i_dw_phi( unsigned int K, unsigned int comp_i, unsigned int comp_j ) const;
+
+  /// The hoop terms of the test and trial functions of the component c for the axisymmetric
+  /// formulation
+  Real hoopTest( unsigned int c ) const
+  {
+    return MicropolarHoop::factor( c ) * _test[_i][_qp] / _q_point[_qp]( 0 );
+  }
+  Real hoopPhi( unsigned int c ) const
+  {
+    return MicropolarHoop::factor( c ) * _phi[_j][_qp] / _q_point[_qp]( 0 );
+  }
+
+  /// Derivatives at the current quadrature point, from the element scratch storage or properties
+  const Tensor3333R & dpk_i_dF() const
+  {
+    return _element_moduli ? ( *_element_moduli )[_qp].*_moduli_dF : ( *_dpk_i_dF )[_qp];
+  }
+  const Tensor333R & dpk_i_dw() const
+  {
+    return _element_moduli ? ( *_element_moduli )[_qp].*_moduli_dw : ( *_dpk_i_dw )[_qp];
+  }
+  const Tensor3333R & dpk_i_dgrad_w() const
+  {
+    return _element_moduli ? ( *_element_moduli )[_qp].*_moduli_dgrad_w : ( *_dpk_i_dgrad_w )[_qp];
+  }
+  const Tensor33R & dpk_i_dk() const
+  {
+    return _element_moduli ? ( *_element_moduli )[_qp].*_moduli_dk : ( *_dpk_i_dk )[_qp];
+  }
+
+  /// The component of the j-th coupled micro rotation; for plane strain, the single micro
+  /// rotation is the rotation about the out-of-plane axis
+  unsigned int mrotComponent( unsigned int j ) const { return _nmrot == 1 ? 2 : j; }
+
   /// Base name of the material system that this kernel applies to
   const std::string _base_name;
   /// Tensor of which the divergence is computed
@@ -59,10 +103,18 @@ protected:
   const MaterialProperty< Tensor33R > & _pk_i;
 
   //// Derivatives of the w.r.t. deformation gradient, micro rotations, material gradient of the micro rotations and the nonlocal damage driving field
-  const MaterialProperty< Tensor3333R > & _dpk_i_dF;
-  const MaterialProperty< Tensor333R > & _dpk_i_dw;
-  const MaterialProperty< Tensor3333R > & _dpk_i_dgrad_w;
-  const MaterialProperty< Tensor33R > & _dpk_i_dk;
+  const MaterialProperty< Tensor3333R > * _dpk_i_dF;
+  const MaterialProperty< Tensor333R > * _dpk_i_dw;
+  const MaterialProperty< Tensor3333R > * _dpk_i_dgrad_w;
+  const MaterialProperty< Tensor33R > * _dpk_i_dk;
+
+  /// The element scratch storage of the moduli, if the material keeps them there
+  const std::vector< GradientEnhancedMicropolarModuli > * _element_moduli;
+  /// The members of the element scratch storage corresponding to the derivatives of the tensor
+  Tensor3333R GradientEnhancedMicropolarModuli::*_moduli_dF;
+  Tensor333R GradientEnhancedMicropolarModuli::*_moduli_dw;
+  Tensor3333R GradientEnhancedMicropolarModuli::*_moduli_dgrad_w;
+  Tensor33R GradientEnhancedMicropolarModuli::*_moduli_dk;
 
   /// An integer corresponding to the direction this kernel acts in
   const unsigned int _component;
@@ -79,4 +131,7 @@ protected:
 
   /// The MOOSE variable number of the nonlocal damage variable
   unsigned int _nonlocal_damage_var;
+
+  /// Axisymmetric formulation with the hoop terms of the RZ coordinate system
+  bool _axisymmetric;
 };
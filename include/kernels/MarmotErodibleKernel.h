@@ -0,0 +1,57 @@
+/* ---------------------------------------------------------------------
+ *       _                           _
+ *   ___| |__   __ _ _ __ ___   ___ (_)___
+ *  / __| '_ \ / _` | '_ ` _ \ / _ \| / __|
+ * | (__| | | | (_| | | | | | | (_) | \__ \
+ *  \___|_| |_|\__,_|_| |_| |_|\___/|_|___/
+ *
+ * Chamois - a MOOSE interface to constitutive models developed at the
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of chamois.
+ * ---------------------------------------------------------------------
+ */
+
+
+#pragma once
+
+#include "InputParameters.h"
+
+class MarmotElementErosion;
+
+/**
+ * MarmotErodibleKernel adds the optional erosion of failed elements by a MarmotElementErosion to a
+ * kernel: the residual and the Jacobian of eroded elements are skipped. Kernels which override the
+ * computation of the residual and the Jacobian themselves check isCurrentElemEroded() instead.
+ */
+template < typename T >
+class MarmotErodibleKernel : public T
+{
+public:
+  static InputParameters validParams();
+
+  MarmotErodibleKernel( const InputParameters & parameters );
+
+  virtual void initialSetup() override;
+
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+  virtual void computeOffDiagJacobian( unsigned int jvar ) override;
+
+protected:
+  /// Whether the current element is eroded
+  bool isCurrentElemEroded() const;
+
+  /// The optional erosion of failed elements
+  const MarmotElementErosion * _erosion;
+};
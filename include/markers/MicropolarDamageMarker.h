@@ -0,0 +1,56 @@
+/* ---------------------------------------------------------------------
+ *       _                           _
+ *   ___| |__   __ _ _ __ ___   ___ (_)___
+ *  / __| '_ \ / _` | '_ ` _ \ / _ \| / __|
+ * | (__| | | | (_| | | | | | | (_) | \__ \
+ *  \___|_| |_|\__,_|_| |_| |_|\___/|_|___/
+ *
+ * Chamois - a MOOSE interface to constitutive models developed at the
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of chamois.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "QuadraturePointMarker.h"
+
+/**
+ * Marks elements for refinement along a localization band of the gradient-enhanced micropolar
+ * continuum, i.e., where the local damage driving field or the nonlocal damage field exceeds a
+ * threshold, until the element size resolves the nonlocal radius. Elements in undamaged regions
+ * are marked for coarsening.
+ */
+class MicropolarDamageMarker : public QuadraturePointMarker
+{
+public:
+  static InputParameters validParams();
+
+  MicropolarDamageMarker( const InputParameters & parameters );
+
+protected:
+  virtual MarkerValue computeQpMarker() override;
+
+  /// Base name of the material system
+  const std::string _base_name;
+
+  const MaterialProperty< Real > & _k_local;
+  const MaterialProperty< Real > & _nonlocal_radius;
+
+  const Real _refine;
+  const Real _coarsen;
+
+  /// The minimum number of elements per nonlocal radius in the band
+  const Real _elements_per_nonlocal_radius;
+};
@@ -34,6 +34,12 @@ public:
 
   ComputeDeformedBoundaryNormalVector( const InputParameters & parameters );
 
+  /// Compute the deformed normal vector n = J F^-T N, and its derivative w.r.t. F
+  static void computeNormalVector( const Tensor33R & F,
+                                   const Tensor3R & N,
+                                   Tensor3R & n,
+                                   Tensor333R & dn_dF );
+
 protected:
   virtual void computeQpProperties() override;
 
@@ -0,0 +1,78 @@
+/* ---------------------------------------------------------------------
+ *       _                           _
+ *   ___| |__   __ _ _ __ ___   ___ (_)___
+ *  / __| '_ \ / _` | '_ ` _ \ / _ \| / __|
+ * | (__| | | | (_| | | | | | | (_) | \__ \
+ *  \___|_| |_|\__,_|_| |_| |_|\___/|_|___/
+ *
+ * Chamois - a MOOSE interface to constitutive models developed at the
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of chamois.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "ComputeMarmotMaterialGradientEnhancedHypoElastic.h"
+#include "RankTwoTensor.h"
+#include "RankFourTensor.h"
+
+/**
+ * ComputeMarmotGradientEnhancedHypoElasticStress is a wrapper for gradient-enhanced hypoelastic
+ * constitutive models provided by the MarmotUserLibrary, which reads the strain increment and
+ * provides the stress, the Jacobian and the nonlocal damage derivatives directly as tensors.
+ * It replaces the chain of ComputeMarmotMaterialGradientEnhancedHypoElastic and the Voigt
+ * conversion materials, with the Voigt quantities kept only in local storage.
+ */
+class ComputeMarmotGradientEnhancedHypoElasticStress
+  : public ComputeMarmotMaterialBase< MarmotMaterialGradientEnhancedHypoElastic,
+                                      MarmotGradientEnhancedHypoElasticCachedResponse >
+{
+public:
+  static InputParameters validParams();
+
+  ComputeMarmotGradientEnhancedHypoElasticStress( const InputParameters & parameters );
+
+protected:
+  virtual void initQpStatefulProperties() override;
+  virtual void computeQpProperties() override;
+
+  using CachedResponse = MarmotGradientEnhancedHypoElasticCachedResponse;
+
+  /// Integrate the Voigt strain increment, in adaptive substeps if enabled, starting from the
+  /// stress in the response; false if the material fails
+  bool integrateQpStress( Real * statevars,
+                          const std::array< Real, 6 > & dstrain_voigt,
+                          CachedResponse & response );
+
+  /// Convert the Voigt response of the quadrature point to the tensor properties
+  void exposeQpResponse( const CachedResponse & response );
+
+  const VariableValue & _k;
+  const VariableValue & _k_old;
+
+  const MaterialProperty< RankTwoTensor > & _strain_increment;
+
+  MaterialProperty< RankTwoTensor > & _stress;
+  const MaterialProperty< RankTwoTensor > & _stress_old;
+  MaterialProperty< RankFourTensor > & _jacobian_mult;
+
+  MaterialProperty< Real > & _k_local;
+  MaterialProperty< Real > & _nonlocal_radius;
+  MaterialProperty< RankTwoTensor > & _dstress_dk;
+  MaterialProperty< RankTwoTensor > & _dk_local_dstrain;
+
+  /// The Voigt response of the current quadrature point
+  CachedResponse _response;
+};
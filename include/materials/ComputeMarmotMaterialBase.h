@@ -0,0 +1,134 @@
+/* ---------------------------------------------------------------------
+ *       _                           _
+ *   ___| |__   __ _ _ __ ___   ___ (_)___
+ *  / __| '_ \ / _` | '_ ` _ \ / _ \| / __|
+ * | (__| | | | (_| | | | | | | (_) | \__ \
+ *  \___|_| |_|\__,_|_| |_| |_|\___/|_|___/
+ *
+ * Chamois - a MOOSE interface to constitutive models developed at the
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of chamois.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "DerivativeMaterialInterface.h"
+#include "MarmotResponseCache.h"
+#include "MarmotStateVarPool.h"
+#include "MarmotStateVarInterface.h"
+#include "MarmotSuggestedDTInterface.h"
+#include "MarmotStatistics.h"
+
+/**
+ * ComputeMarmotMaterialBase is the common base of the wrappers for constitutive models provided by
+ * the MarmotUserLibrary. It instances the Marmot material, and manages the storage of its state
+ * variables (as a stateful material property or in a pool), the recording of statistics, the
+ * lifetime of the cached responses and the reduction of the suggested time step ratio.
+ */
+template < typename MarmotMaterialType, typename CachedResponse >
+class ComputeMarmotMaterialBase : public DerivativeMaterialInterface< Material >,
+                                  public MarmotStatisticsInterface,
+                                  public MarmotStateVarInterface,
+                                  public MarmotSuggestedDTInterface
+{
+public:
+  static InputParameters validParams();
+
+  ComputeMarmotMaterialBase( const InputParameters & parameters );
+
+  virtual void computeProperties() override;
+
+  virtual void initialSetup() override;
+  virtual void timestepSetup() override;
+  virtual void residualSetup() override;
+  virtual void meshChanged() override;
+
+  virtual const MarmotStatistics * marmotStatistics() const override { return _statistics.get(); }
+
+  virtual std::pair< unsigned int, unsigned int > stateVarIndex( const std::string & name ) override
+  {
+    return marmotStateVarIndex( *_the_material, name );
+  }
+
+protected:
+  virtual void initQpStatefulProperties() override;
+
+  /// Initialize the state variables of a quadrature point, zero by default
+  virtual void initializeStateVars( Real * statevars );
+
+  /// Whether the state variables of a quadrature point are at their initial values, i.e., every
+  /// converged evaluation of the material has been elastic at this point so far
+  bool isInitialState( const Real * statevars ) const
+  {
+    return std::equal( _initial_statevars.begin(), _initial_statevars.end(), statevars );
+  }
+
+  /// Reduce the suggested time step ratios of all quadrature points of the current element
+  void reduceElementSuggestedDTRatio();
+
+  /// Release the cached responses of the current element after they have been reused for the
+  /// Jacobian
+  void releaseCachedResponses();
+
+  /// Initialize the current state variables of the quadrature point from the old ones
+  Real * initQpStateVars();
+  /// Copy the state variables from the pool to the state_vars property
+  void exposeQpStateVars( const Real * statevars );
+
+  /// Copy the recorded statistics of the quadrature point to the material properties
+  void exposeQpStatistics();
+
+  const std::string _base_name;
+  const std::vector< Real > & _material_parameters;
+
+  std::unique_ptr< MarmotMaterialType > _the_material;
+
+  /// Keep the state variables in a contiguous pool instead of a stateful material property
+  const bool _state_vars_in_pool;
+
+  MaterialProperty< std::vector< Real > > & _statevars;
+  const MaterialProperty< std::vector< Real > > * _statevars_old;
+
+  /// The initial state variables of a quadrature point
+  std::vector< Real > _initial_statevars;
+
+  /// Smallest ratio of the suggested to the current time step of the material
+  MaterialProperty< Real > & _suggested_dt_ratio;
+
+  /// Reuse the responses of evaluations at identical solution states
+  const bool _cache_responses;
+  MarmotResponseCache< CachedResponse > _response_cache;
+  /// The key of the current quadrature point, built in place for each evaluation
+  typename MarmotResponseCache< CachedResponse >::Key _cache_key;
+
+  /// Maximum number of local substeps, 1 disables substepping
+  const unsigned int _max_substeps;
+  /// State variables at the beginning of a substep, restored if the substep fails
+  std::vector< Real > _substep_statevars;
+
+  /// The buffers of the state variable pool, shared by all threads
+  MarmotStateVarBuffer & _state_var_pool_current;
+  MarmotStateVarBuffer & _state_var_pool_old;
+  std::shared_ptr< MarmotStateVarPool > _state_var_pool;
+
+  /// Statistics of the evaluations, nullptr unless recording is enabled
+  std::unique_ptr< MarmotStatistics > _statistics;
+  MaterialProperty< Real > * _statistics_compute_time;
+  MaterialProperty< Real > * _statistics_evaluations;
+  MaterialProperty< Real > * _statistics_cutbacks;
+  MaterialProperty< Real > * _statistics_inelastic_evaluations;
+
+  const double _time_old[2];
+};
@@ -24,15 +24,32 @@
 
 #pragma once
 
-#include "DerivativeMaterialInterface.h"
+#include "ComputeMarmotMaterialBase.h"
 #include "Marmot/MarmotMaterialGradientEnhancedHypoElastic.h"
 
+/// The complete response of an evaluation of a MarmotMaterialGradientEnhancedHypoElastic
+struct MarmotGradientEnhancedHypoElasticCachedResponse
+{
+  /// The strain increment, the current and old nonlocal damage, the time and the time increment
+  static constexpr std::size_t key_size = 6 + 4;
+
+  std::array< Real, 6 > stress_voigt;
+  Real k_local;
+  Real nonlocal_radius;
+  std::array< Real, 6 * 6 > dstress_voigt_dstrain_voigt;
+  std::array< Real, 6 > dk_local_dstrain_voigt;
+  std::array< Real, 6 > dstress_voigt_dk;
+  Real suggested_dt_ratio;
+  std::vector< Real > statevars;
+};
+
 /**
  * ComputeMarmotMaterialGradientEnhancedHypoElastic is a wrapper for hypoelastic constitutive models
  * provided by the MarmotUserLibrary.
  */
 class ComputeMarmotMaterialGradientEnhancedHypoElastic
-  : public DerivativeMaterialInterface< Material >
+  : public ComputeMarmotMaterialBase< MarmotMaterialGradientEnhancedHypoElastic,
+                                      MarmotGradientEnhancedHypoElasticCachedResponse >
 {
 public:
   static InputParameters validParams();
@@ -43,15 +60,14 @@ protected:
   virtual void initQpStatefulProperties() override;
   virtual void computeQpProperties() override;
 
-  const std::string _base_name;
-  const std::vector< Real > & _material_parameters;
+  using CachedResponse = MarmotGradientEnhancedHypoElasticCachedResponse;
+
+  /// Integrate the strain increment, in adaptive substeps if enabled; false if the material fails
+  bool integrateQpStress( Real * statevars );
 
   const VariableValue & _k;
   const VariableValue & _k_old;
 
-  MaterialProperty< std::vector< Real > > & _statevars;
-  const MaterialProperty< std::vector< Real > > & _statevars_old;
-
   MaterialProperty< std::array< Real, 6 > > & _stress_voigt;
   const MaterialProperty< std::array< Real, 6 > > & _stress_voigt_old;
   const MaterialProperty< std::array< Real, 6 > > & _dstrain_voigt;
@@ -61,8 +77,4 @@ protected:
   MaterialProperty< Real > & _nonlocal_radius;
   MaterialProperty< std::array< Real, 6 > > & _dstress_voigt_dk;
   MaterialProperty< std::array< Real, 6 > > & _dk_local_dstrain_voigt;
-
-  std::unique_ptr< MarmotMaterialGradientEnhancedHypoElastic > _the_material;
-
-  const double _time_old[2];
 };
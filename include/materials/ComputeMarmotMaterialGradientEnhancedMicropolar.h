@@ -24,74 +24,234 @@
 
 #pragma once
 
-#include "DerivativeMaterialInterface.h"
+#include "ComputeMarmotMaterialBase.h"
 #include "Marmot/MarmotMaterialGradientEnhancedMicropolar.h"
 #include "FastorHelper.h"
+#include "GradientEnhancedMicropolarModuli.h"
+#include "MicropolarHoop.h"
+
+class MarmotElementErosion;
+
+/// The complete response of an evaluation of a MarmotMaterialGradientEnhancedMicropolar
+struct MarmotGradientEnhancedMicropolarCachedResponse
+{
+  /// The old and new deformation gradients, micro rotations and their gradients, the nonlocal
+  /// damage, the time and the time increment
+  static constexpr std::size_t key_size = 4 * 9 + 2 * 3 + 3;
+
+  MarmotMaterialGradientEnhancedMicropolar::ConstitutiveResponse< 3 > response;
+  MarmotMaterialGradientEnhancedMicropolar::AlgorithmicModuli< 3 > algorithmic_moduli;
+  Real suggested_dt_ratio;
+  std::vector< Real > statevars;
+};
 
 /**
  * ComputeMarmotMaterialGradientEnhancedMicropolar is a wrapper for gradient-enhanced micropolar
  * constitutive models provided by Marmot.
  */
 class ComputeMarmotMaterialGradientEnhancedMicropolar
-  : public DerivativeMaterialInterface< Material >
+  : public ComputeMarmotMaterialBase< MarmotMaterialGradientEnhancedMicropolar,
+                                      MarmotGradientEnhancedMicropolarCachedResponse >
 {
 public:
   static InputParameters validParams();
 
   ComputeMarmotMaterialGradientEnhancedMicropolar( const InputParameters & parameters );
 
+  virtual void computeProperties() override;
+
+  virtual void initialSetup() override;
+
+  /// The algorithmic moduli of all quadrature points of the current element, only computed if
+  /// the moduli are kept in the element scratch storage
+  const std::vector< GradientEnhancedMicropolarModuli > & elementModuli() const
+  {
+    return _element_moduli;
+  }
+
+  /// Whether the moduli are kept in the element scratch storage instead of material properties
+  bool moduliInElementScratch() const { return _moduli_in_element_scratch; }
+
+  /// Convert the Kirchhoff stresses to the PKI stresses ( classical & couple ), and compute the
+  /// moment of the Kirchhoff stress tensor
+  static void convertKirchhoffStresses(
+      const Tensor33R & FInv,
+      const MarmotMaterialGradientEnhancedMicropolar::ConstitutiveResponse< 3 > & response,
+      Tensor33R & pk_i_stress,
+      Tensor33R & pk_i_couple_stress,
+      Tensor3R & kirchhoff_moment );
+
+  /// Convert the algorithmic moduli of the Kirchhoff stresses to the moduli of the PKI stresses,
+  /// either into a GradientEnhancedMicropolarModuli or a GradientEnhancedMicropolarModuliRef
+  template < typename Moduli >
+  static void convertAlgorithmicModuli(
+      const Tensor33R & FInv,
+      const MarmotMaterialGradientEnhancedMicropolar::ConstitutiveResponse< 3 > & response,
+      const MarmotMaterialGradientEnhancedMicropolar::AlgorithmicModuli< 3 > & algorithmic_moduli,
+      Moduli & moduli );
+
 protected:
-  virtual void initQpStatefulProperties() override;
   virtual void computeQpProperties() override;
 
-  const std::string _base_name;
-  const std::vector< Real > & _material_parameters;
+  /// Initialize the state variables of a quadrature point by the Marmot material
+  virtual void initializeStateVars( Real * statevars ) override;
+
+  using CachedResponse = MarmotGradientEnhancedMicropolarCachedResponse;
+
+  /// Integrate the deformation increment, in adaptive substeps if enabled; false if the material
+  /// fails
+  bool integrateQpStress(
+      const MarmotMaterialGradientEnhancedMicropolar::DeformationIncrement< 3 > &
+          deformation_increment,
+      MarmotMaterialGradientEnhancedMicropolar::ConstitutiveResponse< 3 > & response,
+      MarmotMaterialGradientEnhancedMicropolar::AlgorithmicModuli< 3 > & algorithmic_moduli,
+      Real * statevars );
+
+  /// Evaluate the Marmot material at the current quadrature point, or reuse a cached response
+  void computeQpStress(
+      const MarmotMaterialGradientEnhancedMicropolar::DeformationIncrement< 3 > &
+          deformation_increment,
+      MarmotMaterialGradientEnhancedMicropolar::ConstitutiveResponse< 3 > & response,
+      MarmotMaterialGradientEnhancedMicropolar::AlgorithmicModuli< 3 > & algorithmic_moduli );
+
+  /// The hoop component of the gradient of the vector field v at the current quadrature point,
+  /// to which its component c contributes; zero unless axisymmetric
+  Tensor33R qpHoopGradient( const VariableValue * v, unsigned int c ) const;
 
-  const std::vector< const VariableGradient * > _grad_disp;
-  const std::vector< const VariableGradient * > _grad_disp_old;
+  /// Element-level evaluation of all quadrature points in a single sweep
+  void computeElementProperties();
 
-  const std::vector< const VariableValue * > _mrot;
-  const std::vector< const VariableValue * > _mrot_old;
+  /// Stress free properties of an eroded element, without evaluating the material. The moduli
+  /// are not computed, as the kernels skip eroded elements
+  void computeErodedProperties();
 
-  const std::vector< const VariableGradient * > _grad_mrot;
-  const std::vector< const VariableGradient * > _grad_mrot_old;
+  /// Declare a derivative property, unless the moduli are kept in the element scratch storage
+  template < typename T >
+  MaterialProperty< T > * declareModuliProperty( const std::string & prop_name,
+                                                 const std::string & var_name )
+  {
+    return _moduli_in_element_scratch
+               ? nullptr
+               : &declarePropertyDerivative< T >( _base_name + prop_name, var_name );
+  }
+
+  /// Convert the algorithmic moduli of the current quadrature point directly into the element
+  /// scratch storage or into the material properties
+  void convertQpAlgorithmicModuli(
+      const Tensor33R & FInv,
+      const MarmotMaterialGradientEnhancedMicropolar::ConstitutiveResponse< 3 > & response,
+      const MarmotMaterialGradientEnhancedMicropolar::AlgorithmicModuli< 3 > & algorithmic_moduli );
+
+  /**
+   * Structure-of-arrays block holding the kinematic quantities of all quadrature points of an
+   * element. Each tensor component is stored contiguously over the quadrature points.
+   */
+  struct ElementBlock
+  {
+    static constexpr unsigned int F_n = 0;
+    static constexpr unsigned int F_np = 9;
+    static constexpr unsigned int W_n = 18;
+    static constexpr unsigned int W_np = 21;
+    static constexpr unsigned int dWdX_n = 24;
+    static constexpr unsigned int dWdX_np = 33;
+    static constexpr unsigned int N = 42;
+    static constexpr unsigned int FInv = 43;
+    static constexpr unsigned int S = 52;
+    static constexpr unsigned int M = 61;
+    static constexpr unsigned int n_components = 70;
+
+    void resize( unsigned int n_qp )
+    {
+      _n_qp = n_qp;
+      _data.resize( n_components * n_qp );
+    }
+
+    Real * operator()( unsigned int component ) { return _data.data() + component * _n_qp; }
+
+    Tensor33R tensor33( unsigned int component, unsigned int qp ) const
+    {
+      Tensor33R T;
+      for ( unsigned int i = 0; i < 9; i++ )
+        T.data()[i] = _data[( component + i ) * _n_qp + qp];
+      return T;
+    }
+
+    Tensor3R tensor3( unsigned int component, unsigned int qp ) const
+    {
+      return Tensor3R{ _data[component * _n_qp + qp],
+                       _data[( component + 1 ) * _n_qp + qp],
+                       _data[( component + 2 ) * _n_qp + qp] };
+    }
+
+    unsigned int _n_qp = 0;
+    std::vector< Real > _data;
+  };
+
+  /// The kinematic fields, always with 3 components; for plane strain, the out-of-plane
+  /// displacement and the in-plane micro rotations are zero
+  std::vector< const VariableGradient * > _grad_disp;
+  std::vector< const VariableGradient * > _grad_disp_old;
+
+  std::vector< const VariableValue * > _mrot;
+  std::vector< const VariableValue * > _mrot_old;
+
+  std::vector< const VariableGradient * > _grad_mrot;
+  std::vector< const VariableGradient * > _grad_mrot_old;
+
+  /// The radial displacement for the hoop terms of the axisymmetric formulation, nullptr in 3D
+  const VariableValue * const _disp_r;
+  const VariableValue * const _disp_r_old;
+
+  /// Axisymmetric formulation, i.e., plane kinematics in the RZ coordinate system
+  bool _axisymmetric;
 
   const VariableValue & _k;
 
+  /// Evaluate the quadrature points element-wise instead of one at a time
+  const bool _element_batched_evaluation;
+
+  /// Keep the algorithmic moduli only in the element scratch storage instead of material properties
+  const bool _moduli_in_element_scratch;
+
   MaterialProperty< Tensor3R > & _kirchhoff_moment;
 
-  MaterialProperty< Tensor333R > & _dkirchhoff_moment_dF;
-  MaterialProperty< Tensor33R > & _dkirchhoff_moment_dw;
-  MaterialProperty< Tensor333R > & _dkirchhoff_moment_dgrad_w;
-  MaterialProperty< Tensor3R > & _dkirchhoff_moment_dk;
+  MaterialProperty< Tensor333R > * _dkirchhoff_moment_dF;
+  MaterialProperty< Tensor33R > * _dkirchhoff_moment_dw;
+  MaterialProperty< Tensor333R > * _dkirchhoff_moment_dgrad_w;
+  MaterialProperty< Tensor3R > * _dkirchhoff_moment_dk;
 
   MaterialProperty< Tensor33R > & _pk_i_stress;
 
-  MaterialProperty< Tensor3333R > & _dpk_i_stress_dF;
-  MaterialProperty< Tensor333R > & _dpk_i_stress_dw;
-  MaterialProperty< Tensor3333R > & _dpk_i_stress_dgrad_w;
-  MaterialProperty< Tensor33R > & _dpk_i_stress_dk;
+  MaterialProperty< Tensor3333R > * _dpk_i_stress_dF;
+  MaterialProperty< Tensor333R > * _dpk_i_stress_dw;
+  MaterialProperty< Tensor3333R > * _dpk_i_stress_dgrad_w;
+  MaterialProperty< Tensor33R > * _dpk_i_stress_dk;
 
   MaterialProperty< Tensor33R > & _pk_i_couple_stress;
 
-  MaterialProperty< Tensor3333R > & _dpk_i_couple_stress_dF;
-  MaterialProperty< Tensor333R > & _dpk_i_couple_stress_dw;
-  MaterialProperty< Tensor3333R > & _dpk_i_couple_stress_dgrad_w;
-  MaterialProperty< Tensor33R > & _dpk_i_couple_stress_dk;
+  MaterialProperty< Tensor3333R > * _dpk_i_couple_stress_dF;
+  MaterialProperty< Tensor333R > * _dpk_i_couple_stress_dw;
+  MaterialProperty< Tensor3333R > * _dpk_i_couple_stress_dgrad_w;
+  MaterialProperty< Tensor33R > * _dpk_i_couple_stress_dk;
 
   MaterialProperty< Real > & _k_local;
 
-  MaterialProperty< Tensor33R > & _dk_local_dF;
-  MaterialProperty< Tensor3R > & _dk_local_dw;
-  MaterialProperty< Tensor33R > & _dk_local_dgrad_w;
-  MaterialProperty< Real > & _dk_local_dk;
+  MaterialProperty< Tensor33R > * _dk_local_dF;
+  MaterialProperty< Tensor3R > * _dk_local_dw;
+  MaterialProperty< Tensor33R > * _dk_local_dgrad_w;
+  MaterialProperty< Real > * _dk_local_dk;
 
   MaterialProperty< Real > & _nonlocal_radius;
 
-  MaterialProperty< std::vector< Real > > & _statevars;
-  const MaterialProperty< std::vector< Real > > & _statevars_old;
+  /// Element scratch storage, sized once and reused from element to element
+  std::vector< GradientEnhancedMicropolarModuli > _element_moduli;
+  ElementBlock _element_block;
+  std::vector< MarmotMaterialGradientEnhancedMicropolar::ConstitutiveResponse< 3 > >
+      _element_response;
+  std::vector< MarmotMaterialGradientEnhancedMicropolar::AlgorithmicModuli< 3 > >
+      _element_algorithmic_moduli;
 
-  std::unique_ptr< MarmotMaterialGradientEnhancedMicropolar > _the_material;
+  /// The optional erosion of failed elements
+  const MarmotElementErosion * _erosion;
 
-  const double _time_old[2];
 };
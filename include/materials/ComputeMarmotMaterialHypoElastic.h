@@ -24,14 +24,27 @@
 
 #pragma once
 
-#include "DerivativeMaterialInterface.h"
+#include "ComputeMarmotMaterialBase.h"
 #include "Marmot/MarmotMaterialHypoElastic.h"
 
+/// The complete response of an evaluation of a MarmotMaterialHypoElastic
+struct MarmotHypoElasticCachedResponse
+{
+  /// The strain increment, the characteristic element length, the time and the time increment
+  static constexpr std::size_t key_size = 6 + 3;
+
+  std::array< Real, 6 > stress_voigt;
+  std::array< Real, 6 * 6 > dstress_voigt_dstrain_voigt;
+  Real suggested_dt_ratio;
+  std::vector< Real > statevars;
+};
+
 /**
  * ComputeMarmotMaterialHypoElastic is a wrapper for hypoelastic constitutive models provided by
  * the MarmotUserLibrary.
  */
-class ComputeMarmotMaterialHypoElastic : public DerivativeMaterialInterface< Material >
+class ComputeMarmotMaterialHypoElastic
+  : public ComputeMarmotMaterialBase< MarmotMaterialHypoElastic, MarmotHypoElasticCachedResponse >
 {
 public:
   static InputParameters validParams();
@@ -42,11 +55,16 @@ protected:
   virtual void initQpStatefulProperties() override;
   virtual void computeQpProperties() override;
 
-  const std::string _base_name;
-  const std::vector< Real > & _material_parameters;
+  using CachedResponse = MarmotHypoElasticCachedResponse;
+
+  /// Integrate the strain increment, in adaptive substeps if enabled; false if the material fails
+  bool integrateQpStress( Real * statevars );
 
-  MaterialProperty< std::vector< Real > > & _statevars;
-  const MaterialProperty< std::vector< Real > > & _statevars_old;
+  /// Update the stress with the cached elastic stiffness, without calling the material, if the
+  /// quadrature point is in its initial state and the trial stress is below the elastic limit
+  bool computeQpElasticStress( const Real * statevars );
+  /// Cache the elastic stiffness from the first elastic evaluation of a point in its initial state
+  void cacheElasticStiffness( const Real * statevars );
 
   MaterialProperty< std::array< Real, 6 > > & _stress_voigt;
   const MaterialProperty< std::array< Real, 6 > > & _stress_voigt_old;
@@ -55,7 +73,13 @@ protected:
 
   const MaterialProperty< Real > & _characteristic_element_length;
 
-  std::unique_ptr< MarmotMaterialHypoElastic > _the_material;
+  /// Bypass the material for points in their initial state with a trial stress below the elastic
+  /// limit
+  const bool _elastic_fast_path;
+  const Real _elastic_limit;
 
-  const double _time_old[2];
+  /// The elastic stiffness, cached from the first elastic evaluation of a point in its initial
+  /// state
+  bool _has_elastic_stiffness;
+  std::array< Real, 6 * 6 > _elastic_stiffness;
 };
@@ -39,6 +39,13 @@ public:
 
   virtual void computeQpProperties() override;
 
+  /// Convert a Voigt RankFourTensor (in matrix form) to a RankFourTensor
+  static void convert( const std::array< Real, 6 * 6 > & v,
+                       RankFourTensor & tensor,
+                       bool row_major_layout,
+                       bool divide_shear_terms_by_2_ij,
+                       bool divide_shear_terms_by_2_kl );
+
 protected:
   const std::string _base_name;
   const MaterialPropertyName _the_rank_four_tensor_name;
@@ -39,6 +39,11 @@ public:
 
   virtual void computeQpProperties() override;
 
+  /// Convert a RankTwoTensor from Voigt notation
+  static void convert( const std::array< Real, 6 > & v,
+                       RankTwoTensor & tensor,
+                       bool divide_shear_terms_by_2 );
+
 protected:
   const std::string _base_name;
   const MaterialPropertyName _the_rank_two_tensor_name;
@@ -39,6 +39,11 @@ public:
 
   virtual void computeQpProperties() override;
 
+  /// Convert a RankTwoTensor to Voigt notation
+  static void convert( const RankTwoTensor & tensor,
+                       std::array< Real, 6 > & v,
+                       bool multiply_shear_terms_x2 );
+
 protected:
   const std::string _base_name;
   const MaterialPropertyName _the_rank_two_tensor_name;
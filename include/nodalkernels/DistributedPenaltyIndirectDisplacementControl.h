@@ -0,0 +1,77 @@
+/* ---------------------------------------------------------------------
+ *       _                           _
+ *   ___| |__   __ _ _ __ ___   ___ (_)___
+ *  / __| '_ \ / _` | '_ ` _ \ / _ \| / __|
+ * | (__| | | | (_| | | | | | | (_) | \__ \
+ *  \___|_| |_|\__,_|_| |_| |_|\___/|_|___/
+ *
+ * Chamois - a MOOSE interface to constitutive models developed at the
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of chamois.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "NodalKernel.h"
+#include "libmesh/sparsity_pattern.h"
+
+class Function;
+class IndirectDisplacementControlMeasure;
+
+/**
+ * A penalty based implementation of the indirect displacement control technique, which applies
+ * the penalty force to the locally owned primary nodes and obtains the measure of the constraint
+ * from an IndirectDisplacementControlMeasure instead of ghosting the measured nodes. The coupling
+ * of the primary rows to the measured dofs is added to the sparsity pattern of the Jacobian.
+ */
+class DistributedPenaltyIndirectDisplacementControl : public NodalKernel,
+                                                      public SparsityPattern::AugmentSparsityPattern
+{
+public:
+  static InputParameters validParams();
+
+  DistributedPenaltyIndirectDisplacementControl( const InputParameters & parameters );
+
+  virtual void initialSetup() override;
+  virtual void computeJacobian() override;
+
+  /// Add the coupling of the local primary rows to all measured dofs
+  virtual void augment_sparsity_pattern( SparsityPattern::Graph & sparsity,
+                                         std::vector< dof_id_type > & n_nz,
+                                         std::vector< dof_id_type > & n_oz ) override;
+
+protected:
+  virtual Real computeQpResidual() override;
+
+  Real computeStep();
+
+  const IndirectDisplacementControlMeasure & _measure;
+
+  // Penalty if constraint is not satisfied
+  const Real _penalty;
+
+  // We may use a function to describe the loading scheme
+  const Function * const _function;
+
+  // We may normalize the load wrt to the number of primary nodes
+  const bool _normalize_load;
+
+  // The l parameter
+  const Real _l_parameter;
+
+  // This is the penalty parameter, and a potential reduction factor if we normalize wrt to the
+  // number of primary nodes
+  Real _load_factor;
+};
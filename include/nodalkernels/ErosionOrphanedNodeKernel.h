@@ -0,0 +1,54 @@
+/* ---------------------------------------------------------------------
+ *       _                           _
+ *   ___| |__   __ _ _ __ ___   ___ (_)___
+ *  / __| '_ \ / _` | '_ ` _ \ / _ \| / __|
+ * | (__| | | | (_| | | | | | | (_) | \__ \
+ *  \___|_| |_|\__,_|_| |_| |_|\___/|_|___/
+ *
+ * Chamois - a MOOSE interface to constitutive models developed at the
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of chamois.
+ * ---------------------------------------------------------------------
+ */
+
+
+#pragma once
+
+#include "NodalKernel.h"
+
+class MarmotElementErosion;
+
+/**
+ * Freezes the nodes which are connected only to eroded elements at their old value. Without any
+ * element contribution, these degrees of freedom would otherwise render the system singular.
+ */
+class ErosionOrphanedNodeKernel : public NodalKernel
+{
+public:
+  static InputParameters validParams();
+
+  ErosionOrphanedNodeKernel( const InputParameters & parameters );
+
+  virtual void initialSetup() override;
+
+protected:
+  virtual Real computeQpResidual() override;
+  virtual Real computeQpJacobian() override;
+
+  /// The erosion object providing the orphaned nodes
+  const MarmotElementErosion * _erosion;
+
+  /// The value of the variable at the end of the previous time step
+  const VariableValue & _u_old;
+};
@@ -0,0 +1,87 @@
+/* ---------------------------------------------------------------------
+ *       _                           _
+ *   ___| |__   __ _ _ __ ___   ___ (_)___
+ *  / __| '_ \ / _` | '_ ` _ \ / _ \| / __|
+ * | (__| | | | (_| | | | | | | (_) | \__ \
+ *  \___|_| |_|\__,_|_| |_| |_|\___/|_|___/
+ *
+ * Chamois - a MOOSE interface to constitutive models developed at the
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of chamois.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "ElementPostprocessor.h"
+
+/**
+ * Erodes elements whose quadrature points all reach a critical value of a state variable of a
+ * Marmot material, e.g., the damage. Materials and kernels referring to this object skip the
+ * eroded elements, and nodes connected only to eroded elements are reported as orphaned. The
+ * value of the postprocessor is the total eroded volume. Erosion is evaluated at the end of each
+ * time step, and takes effect from the following time step on.
+ */
+class MarmotElementErosion : public ElementPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  MarmotElementErosion( const InputParameters & parameters );
+
+  virtual void initialSetup() override;
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin( const UserObject & y ) override;
+  virtual void finalize() override;
+  virtual PostprocessorValue getValue() override;
+
+  /// Whether an element is eroded, thread safe outside of the execution of this object
+  bool isEroded( const Elem * elem ) const
+  {
+    return _primary->_eroded_elements.count( elem->id() );
+  }
+
+  /// Whether a node is connected only to eroded elements
+  bool isOrphaned( const Node & node ) const
+  {
+    return _primary->_orphaned_nodes.count( node.id() );
+  }
+
+protected:
+  /// Collect the nodes of the given elements, which are connected only to eroded elements
+  void updateOrphanedNodes( const std::vector< dof_id_type > & elem_ids );
+
+  const MaterialProperty< std::vector< Real > > & _state_vars;
+
+  /// The index of the erosion criterion in the state variables
+  unsigned int _index;
+
+  /// The critical value of the state variable
+  const Real _threshold;
+
+  /// The instance of thread 0, which holds the eroded elements and orphaned nodes
+  const MarmotElementErosion * _primary;
+
+  /// The eroded elements of all processors, and their total volume
+  std::set< dof_id_type > & _eroded_elements;
+  Real & _eroded_volume;
+
+  /// The local nodes connected only to eroded elements
+  std::set< dof_id_type > _orphaned_nodes;
+
+  /// Elements eroded in the current execution, and their volume
+  std::vector< dof_id_type > _newly_eroded;
+  Real _newly_eroded_volume;
+};
@@ -0,0 +1,66 @@
+/* ---------------------------------------------------------------------
+ *       _                           _
+ *   ___| |__   __ _ _ __ ___   ___ (_)___
+ *  / __| '_ \ / _` | '_ ` _ \ / _ \| / __|
+ * | (__| | | | (_| | | | | | | (_) | \__ \
+ *  \___|_| |_|\__,_|_| |_| |_|\___/|_|___/
+ *
+ * Chamois - a MOOSE interface to constitutive models developed at the
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of chamois.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "GeneralPostprocessor.h"
+
+class MarmotStatistics;
+
+/**
+ * Reports an aggregate statistic of the evaluations of a Marmot material wrapper in the current
+ * time step, summed over all threads and processors.
+ */
+class MarmotMaterialStatistics : public GeneralPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  MarmotMaterialStatistics( const InputParameters & parameters );
+
+  virtual void initialSetup() override;
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+  virtual PostprocessorValue getValue() override;
+
+protected:
+  /// The statistics of the material on the given thread
+  const MarmotStatistics & threadStatistics( THREAD_ID tid ) const;
+
+  const MaterialName & _material_name;
+
+  enum class Statistic
+  {
+    compute_time,
+    evaluations,
+    cutbacks,
+    inelastic_evaluations,
+    elastic_evaluations
+  };
+
+  const Statistic _statistic;
+
+  Real _value;
+};
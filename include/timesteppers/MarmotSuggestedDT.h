@@ -0,0 +1,54 @@
+/* ---------------------------------------------------------------------
+ *       _                           _
+ *   ___| |__   __ _ _ __ ___   ___ (_)___
+ *  / __| '_ \ / _` | '_ ` _ \ / _ \| / __|
+ * | (__| | | | (_| | | | | | | (_) | \__ \
+ *  \___|_| |_|\__,_|_| |_| |_|\___/|_|___/
+ *
+ * Chamois - a MOOSE interface to constitutive models developed at the
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of chamois.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "TimeStepper.h"
+
+/**
+ * MarmotSuggestedDT scales the time step by the smallest ratio of the suggested to the current
+ * time step of the Marmot materials, as reduced by the materials over their evaluations in the
+ * last residual evaluation, and over all threads and processors.
+ */
+class MarmotSuggestedDT : public TimeStepper
+{
+public:
+  static InputParameters validParams();
+
+  MarmotSuggestedDT( const InputParameters & parameters );
+
+protected:
+  virtual Real computeInitialDT() override;
+  virtual Real computeDT() override;
+
+  /// Minimum of the suggested time step ratio of the materials over all threads and processors
+  Real suggestedDTRatio() const;
+
+  const Real _initial_dt;
+
+  const std::vector< MaterialName > & _material_names;
+
+  const Real _growth_factor;
+  const Real _cutback_factor;
+};
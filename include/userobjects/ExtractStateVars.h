@@ -0,0 +1,73 @@
+/* ---------------------------------------------------------------------
+ *       _                           _
+ *   ___| |__   __ _ _ __ ___   ___ (_)___
+ *  / __| '_ \ / _` | '_ ` _ \ / _ \| / __|
+ * | (__| | | | (_| | | | | | | (_) | \__ \
+ *  \___|_| |_|\__,_|_| |_| |_|\___/|_|___/
+ *
+ * Chamois - a MOOSE interface to constitutive models developed at the
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of chamois.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "ElementUserObject.h"
+
+/**
+ * Extracts multiple entries of the state variables of a Marmot material into elemental aux
+ * variables in a single element loop. The entries are selected by index, or by the names of the
+ * state variables of the material. Each aux variable receives the volume average of its entry over
+ * the quadrature points of the element.
+ */
+class ExtractStateVars : public ElementUserObject
+{
+public:
+  static InputParameters validParams();
+
+  ExtractStateVars( const InputParameters & parameters );
+
+  virtual void initialSetup() override;
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin( const UserObject & y ) override;
+  virtual void finalize() override;
+
+protected:
+  /// Whether the current time step is an extraction step
+  bool extractInCurrentStep() const;
+
+  /// Check the indices against the number of state variables of the current element
+  void checkIndices();
+
+  const MaterialProperty< std::vector< Real > > & _state_vars;
+
+  const std::vector< AuxVariableName > & _variable_names;
+
+  /// The index in the state variables for each aux variable
+  std::vector< unsigned int > _indices;
+
+  /// Extract only every n-th time step, e.g., at the time step interval of the outputs
+  const unsigned int _time_step_interval;
+
+  /// Whether the indices have been checked against the number of state variables
+  bool _indices_checked;
+
+  AuxiliarySystem & _aux_sys;
+  std::vector< unsigned int > _var_numbers;
+
+  /// Scratch storage of the element averages
+  std::vector< Real > _averages;
+};
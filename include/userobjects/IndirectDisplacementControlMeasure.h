@@ -0,0 +1,77 @@
+/* ---------------------------------------------------------------------
+ *       _                           _
+ *   ___| |__   __ _ _ __ ___   ___ (_)___
+ *  / __| '_ \ / _` | '_ ` _ \ / _ \| / __|
+ * | (__| | | | (_| | | | | | | (_) | \__ \
+ *  \___|_| |_|\__,_|_| |_| |_|\___/|_|___/
+ *
+ * Chamois - a MOOSE interface to constitutive models developed at the
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of chamois.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "NodalUserObject.h"
+
+/**
+ * Computes the measure c · u of an indirect displacement control over nodesets with one
+ * coefficient each, using only local nodes and a single reduction, which makes it usable with
+ * distributed meshes.
+ */
+class IndirectDisplacementControlMeasure : public NodalUserObject
+{
+public:
+  static InputParameters validParams();
+
+  IndirectDisplacementControlMeasure( const InputParameters & parameters );
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin( const UserObject & y ) override;
+  virtual void finalize() override;
+  virtual void meshChanged() override;
+
+  /// The measure c · u, summed over all processors
+  Real value() const { return _value; }
+
+  /// The global dof indices of all measured nodes and their coefficients, on all processors
+  const std::vector< std::pair< dof_id_type, Real > > & coefficients() const
+  {
+    return _coefficients;
+  }
+
+  /// Gather the global dof indices of all measured nodes directly from the mesh, e.g., to build
+  /// a sparsity pattern before the coefficients are available; collective
+  std::vector< dof_id_type > gatherMeasuredDofs() const;
+
+protected:
+  MooseVariable & _var;
+  const VariableValue & _u;
+
+  /// One coefficient per measured boundary
+  const std::vector< Real > _c_vector;
+  const std::vector< BoundaryID > _measured_boundary_ids;
+
+  /// Contributions c_i * u_i of the local nodes, keyed by dof to count shared nodes once
+  std::map< dof_id_type, Real > _local_terms;
+  std::map< dof_id_type, Real > _local_coefficients;
+
+  /// The dofs are gathered only initially and after mesh changes
+  bool _update_coefficients;
+
+  Real _value;
+  std::vector< std::pair< dof_id_type, Real > > _coefficients;
+};
@@ -0,0 +1,113 @@
+/* ---------------------------------------------------------------------
+ *       _                           _
+ *   ___| |__   __ _ _ __ ___   ___ (_)___
+ *  / __| '_ \ / _` | '_ ` _ \ / _ \| / __|
+ * | (__| | | | (_| | | | | | | (_) | \__ \
+ *  \___|_| |_|\__,_|_| |_| |_|\___/|_|___/
+ *
+ * Chamois - a MOOSE interface to constitutive models developed at the
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of chamois.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "GeneralUserObject.h"
+#include "GradientEnhancedMicropolarModuli.h"
+
+#include "libmesh/numeric_vector.h"
+
+#include <petscsnes.h>
+
+/**
+ * Matrix-free application of the consistent tangent of the gradient-enhanced micropolar
+ * continuum. The Newton operator is replaced by a PETSc shell matrix, whose product is the
+ * product of the assembled matrix and the blocks of the element tangent, which are not part of
+ * the sparsity pattern of the assembled matrix. These are applied element by element from the
+ * algorithmic moduli recorded by the GradientEnhancedMicropolarElementKernel during the Jacobian
+ * evaluation. Hence, a reduced coupling of the variables in the Preconditioning block (e.g.,
+ * full = false) yields a cheaper assembled preconditioner, while the Newton operator remains
+ * exact.
+ */
+class MicropolarMatrixFreeTangent : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+
+  MicropolarMatrixFreeTangent( const InputParameters & parameters );
+  virtual ~MicropolarMatrixFreeTangent();
+
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual void finalize() override {}
+
+  /// The number of fields: 3 displacements, 3 micro rotations and the nonlocal damage
+  static constexpr unsigned int n_fields = 7;
+
+  /// Everything required to apply the unassembled blocks of an element tangent
+  struct ElementData
+  {
+    /// The dof indices of all fields, in the order displacements, micro rotations, damage
+    std::array< std::vector< dof_id_type >, n_fields > dofs;
+    /// The blocks (a, b) not contained in the assembled matrix, stored at a * n_fields + b
+    std::array< bool, n_fields * n_fields > unassembled;
+    /// The scaling factors of the fields, which MOOSE applies to the rows of the assembled matrix
+    std::array< Real, n_fields > scaling;
+
+    /// Shape functions and their gradients, stored at qp * n_dofs + i
+    std::vector< Real > phi;
+    std::vector< RealGradient > grad_phi;
+
+    std::vector< Real > JxW;
+    std::vector< Real > nonlocal_radius_sq;
+    std::vector< GradientEnhancedMicropolarModuli > moduli;
+  };
+
+  /// The (thread safe) storage of an element, to be filled by the kernels during the Jacobian
+  /// evaluation
+  ElementData & elementData( dof_id_type elem_id ) const;
+
+  /// y = A x, the product with the full tangent
+  void apply( Vec x, Vec y );
+
+protected:
+  /// Replaces the Newton operator with the shell matrix before each nonlinear iteration
+  static PetscErrorCode snesUpdate( SNES snes, PetscInt step );
+
+  static PetscErrorCode shellMult( Mat shell, Vec x, Vec y );
+
+  /// Adds the unassembled blocks of an element tangent, applied to the local values xe
+  void applyElement( const ElementData & data,
+                     const std::array< std::vector< Real >, n_fields > & xe,
+                     std::array< std::vector< Real >, n_fields > & ye ) const;
+
+  /// Collect the rows replaced by nodal boundary conditions
+  void collectConstrainedDofs();
+
+  mutable std::unordered_map< dof_id_type, ElementData > _element_data;
+
+  /// Locally owned rows of nodal boundary conditions, which are not touched by the shell
+  std::vector< dof_id_type > _constrained_dofs;
+
+  /// The shell matrix, and the assembled matrix, which is used as preconditioner
+  Mat _shell;
+  Mat _assembled;
+
+  std::unique_ptr< NumericVector< Number > > _x_local;
+  std::unique_ptr< NumericVector< Number > > _correction;
+};
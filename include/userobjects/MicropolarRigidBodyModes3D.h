@@ -0,0 +1,61 @@
+/* ---------------------------------------------------------------------
+ *       _                           _
+ *   ___| |__   __ _ _ __ ___   ___ (_)___
+ *  / __| '_ \ / _` | '_ ` _ \ / _ \| / __|
+ * | (__| | | | (_| | | | | | | (_) | \__ \
+ *  \___|_| |_|\__,_|_| |_| |_|\___/|_|___/
+ *
+ * Chamois - a MOOSE interface to constitutive models developed at the
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of chamois.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "NodalUserObject.h"
+
+/**
+ * Fills the near nullspace vectors of the gradient-enhanced micropolar continuum for algebraic
+ * multigrid: three rigid body translations, three rigid body rotations with the micro rotations
+ * equal to the rotation of the body, and the constant mode of the nonlocal damage field.
+ */
+class MicropolarRigidBodyModes3D : public NodalUserObject
+{
+public:
+  static InputParameters validParams();
+
+  MicropolarRigidBodyModes3D( const InputParameters & parameters );
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin( const UserObject & y ) override;
+  virtual void finalize() override;
+
+  /// The number of modes
+  static constexpr unsigned int n_modes = 7;
+
+protected:
+  /// The names of the near nullspace vectors, in the order of the modes
+  std::vector< std::string > _mode_names;
+
+  /// The near nullspace vectors, in the order of the modes
+  std::vector< NumericVector< Number > * > _modes;
+
+  std::vector< unsigned int > _disp_var_numbers;
+  std::vector< unsigned int > _mrot_var_numbers;
+  unsigned int _damage_var_number;
+
+  unsigned int _sys_number;
+};
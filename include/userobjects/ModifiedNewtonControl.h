@@ -0,0 +1,80 @@
+/* ---------------------------------------------------------------------
+ *       _                           _
+ *   ___| |__   __ _ _ __ ___   ___ (_)___
+ *  / __| '_ \ / _` | '_ ` _ \ / _ \| / __|
+ * | (__| | | | (_| | | | | | | (_) | \__ \
+ *  \___|_| |_|\__,_|_| |_| |_|\___/|_|___/
+ *
+ * Chamois - a MOOSE interface to constitutive models developed at the
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of chamois.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "GeneralUserObject.h"
+
+#include <petscsnes.h>
+
+/**
+ * Switches the nonlinear solver to a modified Newton method: the last assembled tangent (and its
+ * preconditioner) is reused for subsequent iterations and time steps, and it is refreshed only
+ * if the residual reduction stalls, after a maximum number of reuses, or after a failed solve.
+ * As long as the tangent is reused, the Jacobian is not assembled at all, and hence the Marmot
+ * wrappers skip the conversion of the algorithmic moduli.
+ */
+class ModifiedNewtonControl : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+
+  ModifiedNewtonControl( const InputParameters & parameters );
+
+  virtual void initialSetup() override;
+  virtual void timestepSetup() override;
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual void finalize() override {}
+
+  /// The number of tangent refreshes so far, i.e., of assemblies of the tangent
+  unsigned int refreshes() const { return _refreshes; }
+
+protected:
+  /// Called by PETSc before each nonlinear iteration, i.e., before the Jacobian would be computed
+  static PetscErrorCode monitor( SNES snes, PetscInt its, PetscReal fnorm, void * context );
+
+  /// Requests the assembly of the tangent at the next nonlinear iteration
+  void refresh( SNES snes );
+
+  /// Refresh if the residual norm ratio of two subsequent iterations exceeds this value
+  const Real _stall_ratio;
+
+  /// Maximum number of iterations with the same tangent, 0 for unlimited
+  const unsigned int _max_reuse;
+
+  /// Refresh the tangent at the beginning of every time step
+  const bool _refresh_each_timestep;
+
+  /// The SNES the monitor is attached to
+  SNES _snes;
+
+  Real _previous_fnorm;
+  unsigned int _reuses;
+  unsigned int _refreshes;
+
+  /// A refresh was requested, but the tangent has not been assembled yet
+  bool _refresh_pending;
+};
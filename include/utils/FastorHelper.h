@@ -33,67 +33,158 @@ using Tensor33R = Fastor::Tensor< Real, 3, 3 >;
 using Tensor333R = Fastor::Tensor< Real, 3, 3, 3 >;
 using Tensor3333R = Fastor::Tensor< Real, 3, 3, 3, 3 >;
 
-template <>
+/// Fastor tensors are serialized as a single contiguous block of scalars, with the same layout
+/// as scalar-wise serialization
+template < typename T >
+inline void
+dataStoreFastorTensor( std::ostream & stream, T & d )
+{
+  stream.write( reinterpret_cast< const char * >( d.data() ), sizeof( Real ) * d.size() );
+}
+
+template < typename T >
 inline void
-dataStore( std::ostream & stream, Tensor3R & d, void * context )
+dataLoadFastorTensor( std::istream & stream, T & d )
 {
-  for ( unsigned int i = 0; i < d.size(); i++ )
-    storeHelper( stream, *( d.data() + i ), context );
+  stream.read( reinterpret_cast< char * >( d.data() ), sizeof( Real ) * d.size() );
 }
 
 template <>
 inline void
-dataLoad( std::istream & stream, Tensor3R & d, void * context )
+dataStore( std::ostream & stream, Tensor3R & d, void * /*context*/ )
 {
+  dataStoreFastorTensor( stream, d );
+}
 
-  for ( unsigned int i = 0; i < d.size(); i++ )
-    loadHelper( stream, *( d.data() + i ), context );
+template <>
+inline void
+dataLoad( std::istream & stream, Tensor3R & d, void * /*context*/ )
+{
+  dataLoadFastorTensor( stream, d );
 }
 
 template <>
 inline void
-dataStore( std::ostream & stream, Tensor33R & d, void * context )
+dataStore( std::ostream & stream, Tensor33R & d, void * /*context*/ )
 {
-  for ( unsigned int i = 0; i < d.size(); i++ )
-    storeHelper( stream, *( d.data() + i ), context );
+  dataStoreFastorTensor( stream, d );
 }
 
 template <>
 inline void
-dataLoad( std::istream & stream, Tensor33R & d, void * context )
+dataLoad( std::istream & stream, Tensor33R & d, void * /*context*/ )
 {
-  for ( unsigned int i = 0; i < d.size(); i++ )
-    loadHelper( stream, *( d.data() + i ), context );
+  dataLoadFastorTensor( stream, d );
 }
 
 template <>
 inline void
-dataStore( std::ostream & stream, Tensor333R & d, void * context )
+dataStore( std::ostream & stream, Tensor333R & d, void * /*context*/ )
 {
-  for ( unsigned int i = 0; i < d.size(); i++ )
-    storeHelper( stream, *( d.data() + i ), context );
+  dataStoreFastorTensor( stream, d );
 }
 
 template <>
 inline void
-dataLoad( std::istream & stream, Tensor333R & d, void * context )
+dataLoad( std::istream & stream, Tensor333R & d, void * /*context*/ )
 {
-  for ( unsigned int i = 0; i < d.size(); i++ )
-    loadHelper( stream, *( d.data() + i ), context );
+  dataLoadFastorTensor( stream, d );
 }
 
 template <>
 inline void
-dataStore( std::ostream & stream, Tensor3333R & d, void * context )
+dataStore( std::ostream & stream, Tensor3333R & d, void * /*context*/ )
 {
-  for ( unsigned int i = 0; i < d.size(); i++ )
-    storeHelper( stream, *( d.data() + i ), context );
+  dataStoreFastorTensor( stream, d );
 }
 
 template <>
 inline void
-dataLoad( std::istream & stream, Tensor3333R & d, void * context )
+dataLoad( std::istream & stream, Tensor3333R & d, void * /*context*/ )
+{
+  dataLoadFastorTensor( stream, d );
+}
+
+/**
+ * Specialized kernels for the tensor transforms of the micropolar continuum. The tensors are
+ * addressed through their contiguous, row major data, with all trailing indices flattened, and the
+ * loops run over compile time bounds only, so that the compiler can fully unroll them. Compared to
+ * the general Fastor::einsum contractions, the structural zeros of the Levi-Civita tensor and of
+ * the derivative of the inverse deformation gradient are never multiplied.
+ */
+namespace FastorHelper
+{
+
+/// The moment m_l... = ε_ijl T_ij... of a tensor T with any number of trailing indices
+template < size_t... Rest >
+inline Fastor::Tensor< Real, 3, Rest... >
+leviCivitaContraction( const Fastor::Tensor< Real, 3, 3, Rest... > & T )
+{
+  constexpr size_t N = ( size_t( 1 ) * ... * Rest );
+
+  Fastor::Tensor< Real, 3, Rest... > m;
+
+  const Real * t = T.data();
+  Real * r = m.data();
+
+  for ( size_t n = 0; n < N; n++ )
+  {
+    r[0 * N + n] = t[( 1 * 3 + 2 ) * N + n] - t[( 2 * 3 + 1 ) * N + n];
+    r[1 * N + n] = t[( 2 * 3 + 0 ) * N + n] - t[( 0 * 3 + 2 ) * N + n];
+    r[2 * N + n] = t[( 0 * 3 + 1 ) * N + n] - t[( 1 * 3 + 0 ) * N + n];
+  }
+
+  return m;
+}
+
+/// The pull back P_I... = FInv_Ii T_i... of the first index of a tensor T with any number of
+/// trailing indices
+template < size_t... Rest >
+inline Fastor::Tensor< Real, 3, Rest... >
+firstIndexPullBack( const Tensor33R & FInv, const Fastor::Tensor< Real, 3, Rest... > & T )
+{
+  constexpr size_t N = ( size_t( 1 ) * ... * Rest );
+
+  Fastor::Tensor< Real, 3, Rest... > P;
+
+  const Real * a = FInv.data();
+  const Real * t = T.data();
+  Real * r = P.data();
+
+  for ( size_t I = 0; I < 3; I++ )
+    for ( size_t n = 0; n < N; n++ )
+      r[I * N + n] = a[I * 3 + 0] * t[0 * N + n] + a[I * 3 + 1] * t[1 * N + n] +
+                     a[I * 3 + 2] * t[2 * N + n];
+
+  return P;
+}
+
+/**
+ * The derivative of the pull back P_Ij = FInv_Ii T_ij w.r.t. the deformation gradient F_kK,
+ *
+ *   dP_Ij/dF_kK = FInv_Ii dT_ij/dF_kK - FInv_Ik FInv_Ki T_ij
+ *               = FInv_Ii dT_ij/dF_kK - FInv_Ik P_Kj,
+ *
+ * which avoids forming the derivative of the inverse deformation gradient.
+ */
+inline Tensor3333R
+firstIndexPullBackDerivative( const Tensor33R & FInv,
+                              const Tensor33R & P,
+                              const Tensor3333R & dT_dF )
 {
-  for ( unsigned int i = 0; i < d.size(); i++ )
-    loadHelper( stream, *( d.data() + i ), context );
+  Tensor3333R dP_dF = firstIndexPullBack( FInv, dT_dF );
+
+  const Real * a = FInv.data();
+  const Real * p = P.data();
+  Real * r = dP_dF.data();
+
+  for ( size_t I = 0; I < 3; I++ )
+    for ( size_t j = 0; j < 3; j++ )
+      for ( size_t k = 0; k < 3; k++ )
+        for ( size_t K = 0; K < 3; K++ )
+          r[( ( I * 3 + j ) * 3 + k ) * 3 + K] -= a[I * 3 + k] * p[K * 3 + j];
+
+  return dP_dF;
 }
+
+} // namespace FastorHelper
@@ -0,0 +1,83 @@
+/* ---------------------------------------------------------------------
+ *       _                           _
+ *   ___| |__   __ _ _ __ ___   ___ (_)___
+ *  / __| '_ \ / _` | '_ ` _ \ / _ \| / __|
+ * | (__| | | | (_| | | | | | | (_) | \__ \
+ *  \___|_| |_|\__,_|_| |_| |_|\___/|_|___/
+ *
+ * Chamois - a MOOSE interface to constitutive models developed at the
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of chamois.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "FastorHelper.h"
+
+/**
+ * The algorithmic moduli of the gradient-enhanced micropolar continuum at a single quadrature
+ * point, i.e., the derivatives of the moment of the Kirchhoff stress, the PKI stress, the PKI couple
+ * stress and the local damage driving field w.r.t. the deformation gradient, the micro rotations,
+ * the material gradient of the micro rotations and the nonlocal damage field.
+ */
+struct GradientEnhancedMicropolarModuli
+{
+  Tensor333R dkirchhoff_moment_dF;
+  Tensor33R dkirchhoff_moment_dw;
+  Tensor333R dkirchhoff_moment_dgrad_w;
+  Tensor3R dkirchhoff_moment_dk;
+
+  Tensor3333R dpk_i_stress_dF;
+  Tensor333R dpk_i_stress_dw;
+  Tensor3333R dpk_i_stress_dgrad_w;
+  Tensor33R dpk_i_stress_dk;
+
+  Tensor3333R dpk_i_couple_stress_dF;
+  Tensor333R dpk_i_couple_stress_dw;
+  Tensor3333R dpk_i_couple_stress_dgrad_w;
+  Tensor33R dpk_i_couple_stress_dk;
+
+  Tensor33R dk_local_dF;
+  Tensor3R dk_local_dw;
+  Tensor33R dk_local_dgrad_w;
+  Real dk_local_dk;
+};
+
+/**
+ * References to the algorithmic moduli of a single quadrature point kept elsewhere, e.g., in the
+ * derivative material properties, with the same members as GradientEnhancedMicropolarModuli.
+ */
+struct GradientEnhancedMicropolarModuliRef
+{
+  Tensor333R & dkirchhoff_moment_dF;
+  Tensor33R & dkirchhoff_moment_dw;
+  Tensor333R & dkirchhoff_moment_dgrad_w;
+  Tensor3R & dkirchhoff_moment_dk;
+
+  Tensor3333R & dpk_i_stress_dF;
+  Tensor333R & dpk_i_stress_dw;
+  Tensor3333R & dpk_i_stress_dgrad_w;
+  Tensor33R & dpk_i_stress_dk;
+
+  Tensor3333R & dpk_i_couple_stress_dF;
+  Tensor333R & dpk_i_couple_stress_dw;
+  Tensor3333R & dpk_i_couple_stress_dgrad_w;
+  Tensor33R & dpk_i_couple_stress_dk;
+
+  Tensor33R & dk_local_dF;
+  Tensor3R & dk_local_dw;
+  Tensor33R & dk_local_dgrad_w;
+  Real & dk_local_dk;
+};
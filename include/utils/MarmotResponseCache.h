@@ -0,0 +1,88 @@
+/* ---------------------------------------------------------------------
+ *       _                           _
+ *   ___| |__   __ _ _ __ ___   ___ (_)___
+ *  / __| '_ \ / _` | '_ ` _ \ / _ \| / __|
+ * | (__| | | | (_| | | | | | | (_) | \__ \
+ *  \___|_| |_|\__,_|_| |_| |_|\___/|_|___/
+ *
+ * Chamois - a MOOSE interface to constitutive models developed at the
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of chamois.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <array>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Cache of the constitutive responses at the quadrature points of the local elements, which lives
+ * only from a residual evaluation to the subsequent Jacobian evaluation: the responses are stored
+ * during the residual evaluation, and the responses of an element are released once they have been
+ * reused for the Jacobian. A cached response is reused only if the key, i.e., all inputs of the
+ * constitutive model at the quadrature point including the time and the time increment, is bitwise
+ * identical to the key of the cached evaluation. The key has the fixed size Response::key_size, so
+ * that it is built without allocations. The cache is meant to be cleared at the beginning of each
+ * residual evaluation.
+ */
+template < typename Response >
+class MarmotResponseCache
+{
+public:
+  using Key = std::array< Real, Response::key_size >;
+
+  /// The cached response of a quadrature point for the given key, or nullptr if there is none
+  const Response *
+  find( dof_id_type elem_id, unsigned int qp, const Key & key ) const
+  {
+    const auto it = _entries.find( elem_id );
+    if ( it == _entries.end() || qp >= it->second.size() )
+      return nullptr;
+
+    const auto & entry = it->second[qp];
+    return entry.valid && entry.key == key ? &entry.response : nullptr;
+  }
+
+  /// Store the response of a quadrature point for the given key
+  void store( dof_id_type elem_id, unsigned int qp, const Key & key, const Response & response )
+  {
+    auto & element_entries = _entries[elem_id];
+    if ( qp >= element_entries.size() )
+      element_entries.resize( qp + 1 );
+
+    auto & entry = element_entries[qp];
+    entry.key = key;
+    entry.response = response;
+    entry.valid = true;
+  }
+
+  /// Release the cached responses of an element
+  void release( dof_id_type elem_id ) { _entries.erase( elem_id ); }
+
+  void clear() { _entries.clear(); }
+
+protected:
+  struct Entry
+  {
+    Key key;
+    Response response;
+    bool valid = false;
+  };
+
+  std::unordered_map< dof_id_type, std::vector< Entry > > _entries;
+};
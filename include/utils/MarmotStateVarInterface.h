@@ -0,0 +1,60 @@
+/* ---------------------------------------------------------------------
+ *       _                           _
+ *   ___| |__   __ _ _ __ ___   ___ (_)___
+ *  / __| '_ \ / _` | '_ ` _ \ / _ \| / __|
+ * | (__| | | | (_| | | | | | | (_) | \__ \
+ *  \___|_| |_|\__,_|_| |_| |_|\___/|_|___/
+ *
+ * Chamois - a MOOSE interface to constitutive models developed at the
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of chamois.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <string>
+#include <vector>
+
+/**
+ * Interface of the Marmot material wrappers which resolve the names of the state variables of the
+ * wrapped material to indices in their state_vars property
+ */
+class MarmotStateVarInterface
+{
+public:
+  virtual ~MarmotStateVarInterface() = default;
+
+  /// The index of the first entry of a named state variable in the state_vars property, and its
+  /// number of entries
+  virtual std::pair< unsigned int, unsigned int > stateVarIndex( const std::string & name ) = 0;
+
+protected:
+  /// Resolve a named state variable by its location in a scratch state variable vector, which is
+  /// assigned to the Marmot material only for this query
+  template < typename MarmotMaterialType >
+  static std::pair< unsigned int, unsigned int > marmotStateVarIndex( MarmotMaterialType & material,
+                                                                      const std::string & name )
+  {
+    std::vector< double > statevars( material.getNumberOfRequiredStateVars(), 0.0 );
+    material.assignStateVars( statevars.data(), statevars.size() );
+
+    const auto view = material.getStateView( name );
+
+    return { static_cast< unsigned int >( view.stateLocation - statevars.data() ),
+             static_cast< unsigned int >( view.stateSize ) };
+  }
+};
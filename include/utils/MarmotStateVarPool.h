@@ -0,0 +1,175 @@
+/* ---------------------------------------------------------------------
+ *       _                           _
+ *   ___| |__   __ _ _ __ ___   ___ (_)___
+ *  / __| '_ \ / _` | '_ ` _ \ / _ \| / __|
+ * | (__| | | | (_| | | | | | | (_) | \__ \
+ *  \___|_| |_|\__,_|_| |_| |_|\___/|_|___/
+ *
+ * Chamois - a MOOSE interface to constitutive models developed at the
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of chamois.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "DataIO.h"
+#include "MooseTypes.h"
+#include "libmesh/parallel.h"
+#include "libmesh/point.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace libMesh
+{
+class Elem;
+}
+
+/**
+ * A buffer of a state variable pool. In checkpoints, it is serialized as a single block instead of
+ * value by value, and optionally compressed, together with the ids of the elements of its slots.
+ */
+struct MarmotStateVarBuffer : public std::vector< Real >
+{
+  /// The ids of the elements of the slots, in the order of the slots
+  std::vector< dof_id_type > elem_ids;
+  /// Compress the buffer with zlib when it is stored
+  bool compress = false;
+};
+
+template <>
+void dataStore( std::ostream & stream, MarmotStateVarBuffer & buffer, void * context );
+template <>
+void dataLoad( std::istream & stream, MarmotStateVarBuffer & buffer, void * context );
+
+/**
+ * Contiguous storage of the state variables of a Marmot material for all quadrature points of a
+ * fixed set of elements. Each element owns a slot of max_qps x n_state_vars values in a current and
+ * an old buffer. Both buffers are allocated once; advancing in time swaps them instead of copying,
+ * and a rejected time step is rolled back implicitly, as the current state is always initialized
+ * from the old state. The buffers themselves are owned by the caller, e.g., as restartable data.
+ * After mesh adaptivity, new elements receive the state of the nearest quadrature point of the
+ * elements they replace, which is transferred lazily at their first evaluation. The state of
+ * elements and their sources held by other processors is exchanged beforehand.
+ */
+class MarmotStateVarPool
+{
+public:
+  MarmotStateVarPool( MarmotStateVarBuffer & current, MarmotStateVarBuffer & old );
+
+  /**
+   * Assign a slot to each element and allocate both buffers, zero initialized. Buffers restored
+   * from a checkpoint are instead remapped to the slots by the element ids stored with them; each
+   * element must be contained in the checkpoint.
+   */
+  void allocate( const std::vector< dof_id_type > & elem_ids,
+                 unsigned int max_qps,
+                 unsigned int n_state_vars,
+                 int t_step );
+
+  /**
+   * Fetch the slots of the requested elements from the processors which hold them, e.g., after
+   * repartitioning, and add them to the local slots until the next remap(). Collective on the
+   * communicator; requested elements which are not held by any processor are ignored.
+   */
+  void exchange( const Parallel::Communicator & comm,
+                 const std::vector< dof_id_type > & requested );
+
+  /**
+   * Assign slots to a changed set of elements, e.g., after mesh adaptivity. Kept elements retain
+   * their state. Elements with sources (the parent on refinement, the former children on
+   * coarsening) receive the state of the nearest source quadrature point at their first
+   * evaluation, see locate(). Returns the elements without any state.
+   */
+  std::vector< dof_id_type >
+  remap( const std::vector< dof_id_type > & elem_ids,
+         const std::unordered_map< dof_id_type, std::vector< dof_id_type > > & sources );
+
+  /// Record the location of a quadrature point, and transfer its state if it is pending
+  void locate( const Elem * elem, unsigned int qp, const Point & point );
+
+  /// Whether an element has a slot
+  bool contains( dof_id_type elem_id ) const { return _slots.count( elem_id ); }
+
+  /// The current and old state variables of all quadrature points of an element
+  Real * currentSlot( dof_id_type elem_id ) { return _current.data() + slotOffset( elem_id ); }
+  Real * oldSlot( dof_id_type elem_id ) { return _old.data() + slotOffset( elem_id ); }
+
+  /// The current state variables of a quadrature point
+  Real * current( const Elem * elem, unsigned int qp )
+  {
+    return _current.data() + offset( elem, qp );
+  }
+  /// The old state variables of a quadrature point
+  const Real * old( const Elem * elem, unsigned int qp ) const
+  {
+    return _old.data() + offset( elem, qp );
+  }
+
+  /// The complete current buffer
+  std::vector< Real > & currentBuffer() { return _current; }
+
+  /// Copy the complete current state to the old state, e.g., after the initialization
+  void initializeOld() { _old = _current; }
+
+  /// Make the current state the old state, once per time step
+  void advanceTo( int t_step );
+
+  unsigned int nStateVars() const { return _n_state_vars; }
+  unsigned int maxQps() const { return _max_qps; }
+
+  /// Whether the buffers can be compressed in checkpoints, i.e., libMesh was built with zlib
+  static bool compressionAvailable();
+
+protected:
+  std::size_t slotIndex( dof_id_type elem_id ) const;
+  std::size_t slotOffset( dof_id_type elem_id ) const
+  {
+    return slotIndex( elem_id ) * _max_qps * _n_state_vars;
+  }
+  std::size_t offset( const Elem * elem, unsigned int qp ) const;
+
+  /// Remap buffers restored from a checkpoint to the slots of the given elements
+  void restore( const std::vector< dof_id_type > & elem_ids );
+
+  MarmotStateVarBuffer & _current;
+  MarmotStateVarBuffer & _old;
+
+  /// The indices of the slots in the buffers
+  std::unordered_map< dof_id_type, std::size_t > _slots;
+
+  /// The last recorded locations of all quadrature points of all slots
+  std::vector< Point > _points;
+
+  /// The state of the replaced elements, to be transferred to a new element
+  struct Transfer
+  {
+    std::vector< Point > points;
+    std::vector< Real > current;
+    std::vector< Real > old;
+    /// Per quadrature point of the new element
+    std::vector< char > transferred;
+  };
+  std::unordered_map< dof_id_type, Transfer > _transfers;
+
+  /// The time step of the state captured in the transfers
+  int _transfer_t_step;
+
+  unsigned int _max_qps;
+  unsigned int _n_state_vars;
+
+  /// The time step of the current state
+  int _t_step;
+};
@@ -0,0 +1,116 @@
+/* ---------------------------------------------------------------------
+ *       _                           _
+ *   ___| |__   __ _ _ __ ___   ___ (_)___
+ *  / __| '_ \ / _` | '_ ` _ \ / _ \| / __|
+ * | (__| | | | (_| | | | | | | (_) | \__ \
+ *  \___|_| |_|\__,_|_| |_| |_|\___/|_|___/
+ *
+ * Chamois - a MOOSE interface to constitutive models developed at the
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of chamois.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <algorithm>
+#include <chrono>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Statistics of the evaluations of a Marmot material, per quadrature point of the local elements
+ * and in aggregate. Every call of computeStress is an evaluation, including the repeated
+ * evaluations in the nonlinear iterations and the local substeps. The statistics are meant to be
+ * cleared at the beginning of each time step, so they cover the current time step.
+ */
+class MarmotStatistics
+{
+public:
+  struct Record
+  {
+    /// Wall time spent in computeStress, in seconds
+    Real compute_time = 0.0;
+    /// Number of evaluations
+    Real evaluations = 0.0;
+    /// Number of evaluations in which the material requested a smaller time step
+    Real cutbacks = 0.0;
+    /// Number of evaluations which changed the state variables
+    Real inelastic_evaluations = 0.0;
+  };
+
+  /// Start the clock before an evaluation, and keep a copy of the state variables
+  void begin( const Real * statevars, unsigned int n_state_vars )
+  {
+    _statevars_before.assign( statevars, statevars + n_state_vars );
+    _start = std::chrono::steady_clock::now();
+  }
+
+  /// Stop the clock after an evaluation, and record it for the quadrature point
+  void end( dof_id_type elem_id, unsigned int qp, const Real * statevars, double pNewDt )
+  {
+    const std::chrono::duration< Real > compute_time = std::chrono::steady_clock::now() - _start;
+
+    const bool inelastic =
+        !std::equal( _statevars_before.begin(), _statevars_before.end(), statevars );
+
+    for ( auto * record : { &qpRecord( elem_id, qp ), &_total } )
+    {
+      record->compute_time += compute_time.count();
+      record->evaluations += 1;
+      record->cutbacks += pNewDt < 1.0;
+      record->inelastic_evaluations += inelastic;
+    }
+  }
+
+  /// The statistics of a quadrature point in the current time step
+  Record & qpRecord( dof_id_type elem_id, unsigned int qp )
+  {
+    auto & element_records = _records[elem_id];
+    if ( qp >= element_records.size() )
+      element_records.resize( qp + 1 );
+
+    return element_records[qp];
+  }
+
+  /// The statistics of all local quadrature points in the current time step
+  const Record & total() const { return _total; }
+
+  void clear()
+  {
+    _records.clear();
+    _total = Record();
+  }
+
+protected:
+  std::unordered_map< dof_id_type, std::vector< Record > > _records;
+  Record _total;
+
+  std::vector< Real > _statevars_before;
+  std::chrono::steady_clock::time_point _start;
+};
+
+/**
+ * Interface of the Marmot material wrappers which can record statistics of their evaluations
+ */
+class MarmotStatisticsInterface
+{
+public:
+  virtual ~MarmotStatisticsInterface() = default;
+
+  /// The recorded statistics, or nullptr if recording is disabled
+  virtual const MarmotStatistics * marmotStatistics() const = 0;
+};
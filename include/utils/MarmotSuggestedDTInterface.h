@@ -0,0 +1,58 @@
+/* ---------------------------------------------------------------------
+ *       _                           _
+ *   ___| |__   __ _ _ __ ___   ___ (_)___
+ *  / __| '_ \ / _` | '_ ` _ \ / _ \| / __|
+ * | (__| | | | (_| | | | | | | (_) | \__ \
+ *  \___|_| |_|\__,_|_| |_| |_|\___/|_|___/
+ *
+ * Chamois - a MOOSE interface to constitutive models developed at the
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of chamois.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <algorithm>
+
+/**
+ * Interface of the Marmot material wrappers which reduce the ratio of the suggested to the current
+ * time step over all quadrature points they evaluate, without an additional pass over the mesh.
+ * The reduction is meant to be reset at the beginning of each residual evaluation, so that it
+ * covers the latest solution state, i.e., the converged state at the end of a time step.
+ */
+class MarmotSuggestedDTInterface
+{
+public:
+  virtual ~MarmotSuggestedDTInterface() = default;
+
+  /// The smallest suggested time step ratio of the local quadrature points evaluated by this
+  /// thread, or no_suggestion if the material did not suggest a time step
+  Real minSuggestedDTRatio() const { return _min_suggested_dt_ratio; }
+
+  /// The ratio reported by materials which do not suggest a time step
+  static constexpr Real no_suggestion = 1e36;
+
+protected:
+  void resetSuggestedDTRatio() { _min_suggested_dt_ratio = no_suggestion; }
+  void reduceSuggestedDTRatio( Real ratio )
+  {
+    _min_suggested_dt_ratio = std::min( _min_suggested_dt_ratio, ratio );
+  }
+
+private:
+  Real _min_suggested_dt_ratio = no_suggestion;
+};
@@ -0,0 +1,58 @@
+/* ---------------------------------------------------------------------
+ *       _                           _
+ *   ___| |__   __ _ _ __ ___   ___ (_)___
+ *  / __| '_ \ / _` | '_ ` _ \ / _ \| / __|
+ * | (__| | | | (_| | | | | | | (_) | \__ \
+ *  \___|_| |_|\__,_|_| |_| |_|\___/|_|___/
+ *
+ * Chamois - a MOOSE interface to constitutive models developed at the
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of chamois.
+ * ---------------------------------------------------------------------
+ */
+
+
+#pragma once
+
+#include "MooseTypes.h"
+
+/**
+ * The hoop components of the torsionless axisymmetric micropolar continuum. The ( r, z ) plane is
+ * completed by the out-of-plane axis e_3 = -e_theta to a right-handed basis, so that the micro
+ * rotation is the rotation about e_3 as for plane strain. The gradient of a vector field v, e.g.,
+ * the displacements or the micro rotations, then has the hoop components
+ *
+ *   ( grad v )_33 = v_r / r   and   ( grad v )_r3 = -v_3 / r,
+ *
+ * i.e., the component c of v contributes factor( c ) * v_c / r to ( grad v )_( row( c ), column ).
+ */
+namespace MicropolarHoop
+{
+/// The column of all hoop components, i.e., the derivative w.r.t. the out-of-plane axis
+constexpr unsigned int column = 2;
+
+/// The row of the hoop component, to which the component c of a vector field contributes
+inline unsigned int
+row( unsigned int c )
+{
+  return c == 0 ? 2 : 0;
+}
+
+/// The factor of the contribution of the component c, which is divided by the radius
+inline Real
+factor( unsigned int c )
+{
+  return c == 0 ? 1.0 : ( c == 2 ? -1.0 : 0.0 );
+}
+}
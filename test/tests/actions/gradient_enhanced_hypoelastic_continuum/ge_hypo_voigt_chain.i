@@ -0,0 +1,257 @@
+# Two identical, disconnected specimens under uniaxial tension: the left one is modeled by
+# ComputeMarmotMaterialGradientEnhancedHypoElastic and the chain of Voigt conversion materials,
+# the right one by the GradientEnhancedHypoElasticContinuum action, which must yield the same
+# stresses and nonlocal damage.
+
+[Mesh]
+  [voigt_chain_specimen]
+    type = GeneratedMeshGenerator
+    dim = 3
+    nx = 2
+    ny = 4
+    nz = 1
+    xmax = 10
+    ymax = 20
+    zmax = 5
+    elem_type = HEX8
+  []
+  [action_specimen]
+    type = GeneratedMeshGenerator
+    dim = 3
+    nx = 2
+    ny = 4
+    nz = 1
+    xmin = 20
+    xmax = 30
+    ymax = 20
+    zmax = 5
+    elem_type = HEX8
+  []
+  [combined]
+    type = CombinerGenerator
+    inputs = 'voigt_chain_specimen action_specimen'
+  []
+  [action_block]
+    type = SubdomainBoundingBoxGenerator
+    input = combined
+    bottom_left = '15 -1 -1'
+    top_right = '35 21 6'
+    block_id = 1
+    block_name = action
+  []
+  [voigt_chain_block]
+    type = RenameBlockGenerator
+    input = action_block
+    old_block = 0
+    new_block = voigt_chain
+  []
+[]
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+  nonlocal_damage = nonlocal_damage
+  volumetric_locking_correction = false
+[]
+
+[Variables]
+  [disp_x][]
+  [disp_y][]
+  [disp_z][]
+  [nonlocal_damage][]
+[]
+
+[Kernels]
+  [div_sig_x]
+    type = GradientEnhancedStressDivergenceTensors
+    variable = disp_x
+    component = 0
+    block = voigt_chain
+    use_displaced_mesh = false
+  []
+  [div_sig_y]
+    type = GradientEnhancedStressDivergenceTensors
+    variable = disp_y
+    component = 1
+    block = voigt_chain
+    use_displaced_mesh = false
+  []
+  [div_sig_z]
+    type = GradientEnhancedStressDivergenceTensors
+    variable = disp_z
+    component = 2
+    block = voigt_chain
+    use_displaced_mesh = false
+  []
+  [implicit_gradient_damage]
+    type = ImplicitGradientEnhancedDamage
+    variable = nonlocal_damage
+    block = voigt_chain
+    use_displaced_mesh = false
+  []
+[]
+
+[GradientEnhancedHypoElasticContinuum]
+  [all]
+    block = action
+    marmot_material_name = GRADIENTENHANCEDDRUCKERPRAGER
+    marmot_material_parameters = '25850 0.18 20e3 2.65 0 25 15 15 2 1.00 5e-4 .99'
+  []
+[]
+
+[Materials]
+  [marmot_material]
+    type = ComputeMarmotMaterialGradientEnhancedHypoElastic
+    block = voigt_chain
+    marmot_material_name = GRADIENTENHANCEDDRUCKERPRAGER
+    marmot_material_parameters = '25850 0.18 20e3 2.65 0 25 15 15 2 1.00 5e-4 .99'
+  []
+  [dstrain]
+    type = ComputeIncrementalSmallStrain
+    block = voigt_chain
+  []
+  [dstrain_vgt_conv]
+    type = ConvertRankTwoTensorToVoigt
+    block = voigt_chain
+    tensor = strain_increment
+    tensor_voigt = strain_increment_voigt
+    shear_components_twice = true
+  []
+  [stress_conv]
+    type = ConvertRankTwoTensorFromVoigt
+    block = voigt_chain
+    tensor = stress
+    tensor_voigt = stress_voigt
+    shear_components_half = false
+  []
+  [Jacobian_conv]
+    type = ConvertRankFourTensorFromVoigt
+    block = voigt_chain
+    tensor = Jacobian_mult
+    tensor_voigt = dstress_voigt_dstrain_voigt
+    shear_components_half_ij = false
+    shear_components_half_kl = false
+    tensor_voigt_uses_row_major_layout = false
+  []
+  [dstress_dk_conv]
+    type = ConvertRankTwoTensorFromVoigt
+    block = voigt_chain
+    tensor = dstress_dnonlocal_damage
+    tensor_voigt = dstress_voigt_dnonlocal_damage
+    shear_components_half = false
+  []
+  [dlocal_damage_dstrain_conv]
+    type = ConvertRankTwoTensorFromVoigt
+    block = voigt_chain
+    tensor = dlocal_damage_dstrain
+    tensor_voigt = dlocal_damage_dstrain_voigt
+    shear_components_half = false
+  []
+[]
+
+[AuxVariables]
+  [stress_yy]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[AuxKernels]
+  [stress_yy]
+    type = RankTwoAux
+    variable = stress_yy
+    rank_two_tensor = stress
+    index_i = 1
+    index_j = 1
+  []
+[]
+
+[Postprocessors]
+  [voigt_chain_stress]
+    type = ElementAverageValue
+    variable = stress_yy
+    block = voigt_chain
+    outputs = none
+  []
+  [action_stress]
+    type = ElementAverageValue
+    variable = stress_yy
+    block = action
+    outputs = none
+  []
+  [voigt_chain_damage]
+    type = ElementAverageValue
+    variable = nonlocal_damage
+    block = voigt_chain
+    outputs = none
+  []
+  [action_damage]
+    type = ElementAverageValue
+    variable = nonlocal_damage
+    block = action
+    outputs = none
+  []
+  [stress_difference]
+    type = DifferencePostprocessor
+    value1 = voigt_chain_stress
+    value2 = action_stress
+  []
+  [damage_difference]
+    type = DifferencePostprocessor
+    value1 = voigt_chain_damage
+    value2 = action_damage
+  []
+[]
+
+[BCs]
+  [bottom_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  []
+  [left_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  []
+  [back_z]
+    type = DirichletBC
+    variable = disp_z
+    boundary = back
+    value = 0
+  []
+  [top_y]
+    type = FunctionDirichletBC
+    variable = disp_y
+    boundary = top
+    function = '2e-2 * t'
+  []
+[]
+
+[Preconditioning]
+  [smp]
+    type = SMP
+    full = true
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type -pc_factor_mat_solver_package'
+  petsc_options_value = ' lu       mumps'
+
+  nl_rel_tol = 1e-10
+  nl_abs_tol = 1e-10
+  nl_max_its = 20
+
+  line_search = 'none'
+
+  dt = 0.25
+  end_time = 1.0
+[]
+
+[Outputs]
+  csv = true
+[]
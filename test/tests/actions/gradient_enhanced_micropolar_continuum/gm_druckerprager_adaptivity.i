@@ -0,0 +1,148 @@
+# Runs gm_druckerprager.i with the MicropolarDamageMarker, once with the state variables stored as
+# material properties and once in a pool. The uniformly refined initial mesh is coarsened in the
+# first time step, and refined along the localization band once the damage exceeds the threshold.
+# Both storages must yield the same results.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[MultiApps]
+  [material_property]
+    type = TransientMultiApp
+    input_files = gm_druckerprager.i
+    cli_args = 'Mesh/uniform_refine=1;'
+               'Adaptivity/marker=damage_marker;Adaptivity/max_h_level=1;'
+               'Adaptivity/Markers/damage_marker/type=MicropolarDamageMarker;'
+               'Adaptivity/Markers/damage_marker/variable=nonlocal_damage;'
+               'Adaptivity/Markers/damage_marker/refine=1e-3;'
+               'Adaptivity/Markers/damage_marker/coarsen=1e-5;'
+               'Postprocessors/elements/type=NumElems;'
+               'Postprocessors/disp_x/type=ElementIntegralVariablePostprocessor;'
+               'Postprocessors/disp_x/variable=disp_x;'
+               'Postprocessors/damage/type=ElementIntegralVariablePostprocessor;'
+               'Postprocessors/damage/variable=nonlocal_damage;'
+               'Outputs/exodus=false;Outputs/csv=false'
+  []
+  [pool]
+    type = TransientMultiApp
+    input_files = gm_druckerprager.i
+    cli_args = 'GradientEnhancedMicropolarContinuum/all/state_var_storage=pool;'
+               'Mesh/uniform_refine=1;'
+               'Adaptivity/marker=damage_marker;Adaptivity/max_h_level=1;'
+               'Adaptivity/Markers/damage_marker/type=MicropolarDamageMarker;'
+               'Adaptivity/Markers/damage_marker/variable=nonlocal_damage;'
+               'Adaptivity/Markers/damage_marker/refine=1e-3;'
+               'Adaptivity/Markers/damage_marker/coarsen=1e-5;'
+               'Postprocessors/elements/type=NumElems;'
+               'Postprocessors/disp_x/type=ElementIntegralVariablePostprocessor;'
+               'Postprocessors/disp_x/variable=disp_x;'
+               'Postprocessors/damage/type=ElementIntegralVariablePostprocessor;'
+               'Postprocessors/damage/variable=nonlocal_damage;'
+               'Outputs/exodus=false;Outputs/csv=false'
+  []
+[]
+
+[Transfers]
+  [material_property_elements]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = material_property
+    from_postprocessor = elements
+    to_postprocessor = material_property_elements
+    reduction_type = maximum
+  []
+  [material_property_disp_x]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = material_property
+    from_postprocessor = disp_x
+    to_postprocessor = material_property_disp_x
+    reduction_type = maximum
+  []
+  [material_property_damage]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = material_property
+    from_postprocessor = damage
+    to_postprocessor = material_property_damage
+    reduction_type = maximum
+  []
+  [pool_elements]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = pool
+    from_postprocessor = elements
+    to_postprocessor = pool_elements
+    reduction_type = maximum
+  []
+  [pool_disp_x]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = pool
+    from_postprocessor = disp_x
+    to_postprocessor = pool_disp_x
+    reduction_type = maximum
+  []
+  [pool_damage]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = pool
+    from_postprocessor = damage
+    to_postprocessor = pool_damage
+    reduction_type = maximum
+  []
+[]
+
+[Postprocessors]
+  [material_property_elements]
+    type = Receiver
+    outputs = none
+  []
+  [material_property_disp_x]
+    type = Receiver
+    outputs = none
+  []
+  [material_property_damage]
+    type = Receiver
+    outputs = none
+  []
+  [pool_elements]
+    type = Receiver
+    outputs = none
+  []
+  [pool_disp_x]
+    type = Receiver
+    outputs = none
+  []
+  [pool_damage]
+    type = Receiver
+    outputs = none
+  []
+  [elements_difference]
+    type = LinearCombinationPostprocessor
+    pp_names = 'pool_elements material_property_elements'
+    pp_coefs = '1 -1'
+  []
+  [disp_x_difference]
+    type = LinearCombinationPostprocessor
+    pp_names = 'pool_disp_x material_property_disp_x'
+    pp_coefs = '1 -1'
+  []
+  [damage_difference]
+    type = LinearCombinationPostprocessor
+    pp_names = 'pool_damage material_property_damage'
+    pp_coefs = '1 -1'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  # the time steps of gm_druckerprager.i
+  dt = 1e-1
+  end_time = 1.0
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,177 @@
+# Runs the axisymmetric formulation and the 3D quarter of the hollow cylinder, whose results
+# extended to the complete revolution differ only by the discretization of the hoop direction
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[MultiApps]
+  [axisymmetric]
+    type = TransientMultiApp
+    input_files = gm_druckerprager_axisymmetric.i
+    cli_args = 'Outputs/exodus=false;Outputs/csv=false'
+  []
+  [quarter_cylinder]
+    type = TransientMultiApp
+    input_files = gm_druckerprager_quarter_cylinder.i
+    cli_args = 'Outputs/exodus=false;Outputs/csv=false'
+  []
+[]
+
+[Transfers]
+  [axisymmetric_disp_r_outer]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = axisymmetric
+    from_postprocessor = disp_r_outer
+    to_postprocessor = axisymmetric_disp_r_outer
+    reduction_type = maximum
+  []
+  [axisymmetric_disp_y_outer]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = axisymmetric
+    from_postprocessor = disp_y_outer
+    to_postprocessor = axisymmetric_disp_y_outer
+    reduction_type = maximum
+  []
+  [axisymmetric_microrot_hoop_center]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = axisymmetric
+    from_postprocessor = microrot_hoop_center
+    to_postprocessor = axisymmetric_microrot_hoop_center
+    reduction_type = maximum
+  []
+  [axisymmetric_nonlocal_damage_center]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = axisymmetric
+    from_postprocessor = nonlocal_damage_center
+    to_postprocessor = axisymmetric_nonlocal_damage_center
+    reduction_type = maximum
+  []
+  [axisymmetric_nonlocal_damage_integral]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = axisymmetric
+    from_postprocessor = nonlocal_damage_integral
+    to_postprocessor = axisymmetric_nonlocal_damage_integral
+    reduction_type = maximum
+  []
+  [quarter_cylinder_disp_r_outer]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = quarter_cylinder
+    from_postprocessor = disp_r_outer
+    to_postprocessor = quarter_cylinder_disp_r_outer
+    reduction_type = maximum
+  []
+  [quarter_cylinder_disp_y_outer]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = quarter_cylinder
+    from_postprocessor = disp_y_outer
+    to_postprocessor = quarter_cylinder_disp_y_outer
+    reduction_type = maximum
+  []
+  [quarter_cylinder_microrot_hoop_center]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = quarter_cylinder
+    from_postprocessor = microrot_hoop_center
+    to_postprocessor = quarter_cylinder_microrot_hoop_center
+    reduction_type = maximum
+  []
+  [quarter_cylinder_nonlocal_damage_center]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = quarter_cylinder
+    from_postprocessor = nonlocal_damage_center
+    to_postprocessor = quarter_cylinder_nonlocal_damage_center
+    reduction_type = maximum
+  []
+  [quarter_cylinder_nonlocal_damage_integral]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = quarter_cylinder
+    from_postprocessor = nonlocal_damage_integral
+    to_postprocessor = quarter_cylinder_nonlocal_damage_integral
+    reduction_type = maximum
+  []
+[]
+
+[Postprocessors]
+  [axisymmetric_disp_r_outer]
+    type = Receiver
+    outputs = none
+  []
+  [axisymmetric_disp_y_outer]
+    type = Receiver
+    outputs = none
+  []
+  [axisymmetric_microrot_hoop_center]
+    type = Receiver
+    outputs = none
+  []
+  [axisymmetric_nonlocal_damage_center]
+    type = Receiver
+    outputs = none
+  []
+  [axisymmetric_nonlocal_damage_integral]
+    type = Receiver
+    outputs = none
+  []
+  [quarter_cylinder_disp_r_outer]
+    type = Receiver
+    outputs = none
+  []
+  [quarter_cylinder_disp_y_outer]
+    type = Receiver
+    outputs = none
+  []
+  [quarter_cylinder_microrot_hoop_center]
+    type = Receiver
+    outputs = none
+  []
+  [quarter_cylinder_nonlocal_damage_center]
+    type = Receiver
+    outputs = none
+  []
+  [quarter_cylinder_nonlocal_damage_integral]
+    type = Receiver
+    outputs = none
+  []
+  [disp_r_outer_difference]
+    type = RelativeDifferencePostprocessor
+    value1 = axisymmetric_disp_r_outer
+    value2 = quarter_cylinder_disp_r_outer
+  []
+  [disp_y_outer_difference]
+    type = RelativeDifferencePostprocessor
+    value1 = axisymmetric_disp_y_outer
+    value2 = quarter_cylinder_disp_y_outer
+  []
+  [microrot_hoop_center_difference]
+    type = RelativeDifferencePostprocessor
+    value1 = axisymmetric_microrot_hoop_center
+    value2 = quarter_cylinder_microrot_hoop_center
+  []
+  [nonlocal_damage_center_difference]
+    type = RelativeDifferencePostprocessor
+    value1 = axisymmetric_nonlocal_damage_center
+    value2 = quarter_cylinder_nonlocal_damage_center
+  []
+  [nonlocal_damage_integral_difference]
+    type = RelativeDifferencePostprocessor
+    value1 = axisymmetric_nonlocal_damage_integral
+    value2 = quarter_cylinder_nonlocal_damage_integral
+  []
+[]
+
+[Executioner]
+  type = Transient
+  # the time steps of the sub-apps
+  dt = 1e-1
+  end_time = 1.0
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,130 @@
+# Runs gm_druckerprager.i with the assembled full tangent and with the matrix-free tangent, the
+# latter with an assembled preconditioner of reduced coupling. With the exact Newton operator, the
+# Newton iterations of both are the same in each time step, for the automatic scaling of the fields
+# as well as for manual scaling factors.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[MultiApps]
+  [assembled]
+    type = TransientMultiApp
+    input_files = gm_druckerprager.i
+    cli_args = 'GradientEnhancedMicropolarContinuum/all/fused_element_kernel=true;'
+               'Executioner/l_tol=1e-12;'
+               'Postprocessors/nonlinear_iterations/type=NumNonlinearIterations;'
+               'Outputs/exodus=false;Outputs/csv=false'
+  []
+  [matrix_free]
+    type = TransientMultiApp
+    input_files = gm_druckerprager.i
+    cli_args = 'GradientEnhancedMicropolarContinuum/all/fused_element_kernel=true;'
+               'GradientEnhancedMicropolarContinuum/all/use_matrix_free_tangent=true;'
+               'Preconditioning/smp/full=false;'
+               'Executioner/l_tol=1e-12;'
+               'Postprocessors/nonlinear_iterations/type=NumNonlinearIterations;'
+               'Outputs/exodus=false;Outputs/csv=false'
+  []
+  [assembled_scaled]
+    type = TransientMultiApp
+    input_files = gm_druckerprager.i
+    cli_args = 'GradientEnhancedMicropolarContinuum/all/fused_element_kernel=true;'
+               'Executioner/automatic_scaling=false;'
+               'Variables/microrot_x/scaling=1e3;Variables/microrot_y/scaling=1e3;'
+               'Variables/microrot_z/scaling=1e3;Variables/nonlocal_damage/scaling=1e-2;'
+               'Executioner/l_tol=1e-12;'
+               'Postprocessors/nonlinear_iterations/type=NumNonlinearIterations;'
+               'Outputs/exodus=false;Outputs/csv=false'
+  []
+  [matrix_free_scaled]
+    type = TransientMultiApp
+    input_files = gm_druckerprager.i
+    cli_args = 'GradientEnhancedMicropolarContinuum/all/fused_element_kernel=true;'
+               'GradientEnhancedMicropolarContinuum/all/use_matrix_free_tangent=true;'
+               'Preconditioning/smp/full=false;'
+               'Executioner/automatic_scaling=false;'
+               'Variables/microrot_x/scaling=1e3;Variables/microrot_y/scaling=1e3;'
+               'Variables/microrot_z/scaling=1e3;Variables/nonlocal_damage/scaling=1e-2;'
+               'Executioner/l_tol=1e-12;'
+               'Postprocessors/nonlinear_iterations/type=NumNonlinearIterations;'
+               'Outputs/exodus=false;Outputs/csv=false'
+  []
+[]
+
+[Transfers]
+  [assembled]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = assembled
+    from_postprocessor = nonlinear_iterations
+    to_postprocessor = assembled_iterations
+    reduction_type = maximum
+  []
+  [matrix_free]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = matrix_free
+    from_postprocessor = nonlinear_iterations
+    to_postprocessor = matrix_free_iterations
+    reduction_type = maximum
+  []
+  [assembled_scaled]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = assembled_scaled
+    from_postprocessor = nonlinear_iterations
+    to_postprocessor = assembled_scaled_iterations
+    reduction_type = maximum
+  []
+  [matrix_free_scaled]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = matrix_free_scaled
+    from_postprocessor = nonlinear_iterations
+    to_postprocessor = matrix_free_scaled_iterations
+    reduction_type = maximum
+  []
+[]
+
+[Postprocessors]
+  [assembled_iterations]
+    type = Receiver
+    outputs = none
+  []
+  [matrix_free_iterations]
+    type = Receiver
+    outputs = none
+  []
+  [assembled_scaled_iterations]
+    type = Receiver
+    outputs = none
+  []
+  [matrix_free_scaled_iterations]
+    type = Receiver
+    outputs = none
+  []
+  [iteration_difference]
+    type = LinearCombinationPostprocessor
+    pp_names = 'matrix_free_iterations assembled_iterations'
+    pp_coefs = '1 -1'
+  []
+  [scaled_iteration_difference]
+    type = LinearCombinationPostprocessor
+    pp_names = 'matrix_free_scaled_iterations assembled_scaled_iterations'
+    pp_coefs = '1 -1'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  # the time steps of gm_druckerprager.i
+  dt = 1e-1
+  end_time = 1.0
+[]
+
+[Outputs]
+  csv = true
+[]
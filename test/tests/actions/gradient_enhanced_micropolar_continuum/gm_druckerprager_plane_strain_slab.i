@@ -0,0 +1,204 @@
+# Runs the plane strain formulation and the 3D slab constrained to the plane strain kinematics,
+# whose results per unit thickness must be the same
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[MultiApps]
+  [plane_strain]
+    type = TransientMultiApp
+    input_files = gm_druckerprager_plane_strain.i
+    cli_args = 'Outputs/exodus=false;Outputs/csv=false'
+  []
+  [slab]
+    type = TransientMultiApp
+    input_files = gm_druckerprager_slab.i
+    cli_args = 'Outputs/exodus=false;Outputs/csv=false'
+  []
+[]
+
+[Transfers]
+  [plane_strain_disp_x_center]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = plane_strain
+    from_postprocessor = disp_x_center
+    to_postprocessor = plane_strain_disp_x_center
+    reduction_type = maximum
+  []
+  [plane_strain_disp_y_center]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = plane_strain
+    from_postprocessor = disp_y_center
+    to_postprocessor = plane_strain_disp_y_center
+    reduction_type = maximum
+  []
+  [plane_strain_microrot_z_center]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = plane_strain
+    from_postprocessor = microrot_z_center
+    to_postprocessor = plane_strain_microrot_z_center
+    reduction_type = maximum
+  []
+  [plane_strain_nonlocal_damage_center]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = plane_strain
+    from_postprocessor = nonlocal_damage_center
+    to_postprocessor = plane_strain_nonlocal_damage_center
+    reduction_type = maximum
+  []
+  [plane_strain_microrot_z_integral]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = plane_strain
+    from_postprocessor = microrot_z_integral
+    to_postprocessor = plane_strain_microrot_z_integral
+    reduction_type = maximum
+  []
+  [plane_strain_nonlocal_damage_integral]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = plane_strain
+    from_postprocessor = nonlocal_damage_integral
+    to_postprocessor = plane_strain_nonlocal_damage_integral
+    reduction_type = maximum
+  []
+  [slab_disp_x_center]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = slab
+    from_postprocessor = disp_x_center
+    to_postprocessor = slab_disp_x_center
+    reduction_type = maximum
+  []
+  [slab_disp_y_center]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = slab
+    from_postprocessor = disp_y_center
+    to_postprocessor = slab_disp_y_center
+    reduction_type = maximum
+  []
+  [slab_microrot_z_center]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = slab
+    from_postprocessor = microrot_z_center
+    to_postprocessor = slab_microrot_z_center
+    reduction_type = maximum
+  []
+  [slab_nonlocal_damage_center]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = slab
+    from_postprocessor = nonlocal_damage_center
+    to_postprocessor = slab_nonlocal_damage_center
+    reduction_type = maximum
+  []
+  [slab_microrot_z_integral]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = slab
+    from_postprocessor = microrot_z_integral
+    to_postprocessor = slab_microrot_z_integral
+    reduction_type = maximum
+  []
+  [slab_nonlocal_damage_integral]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = slab
+    from_postprocessor = nonlocal_damage_integral
+    to_postprocessor = slab_nonlocal_damage_integral
+    reduction_type = maximum
+  []
+[]
+
+[Postprocessors]
+  [plane_strain_disp_x_center]
+    type = Receiver
+    outputs = none
+  []
+  [plane_strain_disp_y_center]
+    type = Receiver
+    outputs = none
+  []
+  [plane_strain_microrot_z_center]
+    type = Receiver
+    outputs = none
+  []
+  [plane_strain_nonlocal_damage_center]
+    type = Receiver
+    outputs = none
+  []
+  [plane_strain_microrot_z_integral]
+    type = Receiver
+    outputs = none
+  []
+  [plane_strain_nonlocal_damage_integral]
+    type = Receiver
+    outputs = none
+  []
+  [slab_disp_x_center]
+    type = Receiver
+    outputs = none
+  []
+  [slab_disp_y_center]
+    type = Receiver
+    outputs = none
+  []
+  [slab_microrot_z_center]
+    type = Receiver
+    outputs = none
+  []
+  [slab_nonlocal_damage_center]
+    type = Receiver
+    outputs = none
+  []
+  [slab_microrot_z_integral]
+    type = Receiver
+    outputs = none
+  []
+  [slab_nonlocal_damage_integral]
+    type = Receiver
+    outputs = none
+  []
+  [disp_x_center_difference]
+    type = RelativeDifferencePostprocessor
+    value1 = plane_strain_disp_x_center
+    value2 = slab_disp_x_center
+  []
+  [disp_y_center_difference]
+    type = RelativeDifferencePostprocessor
+    value1 = plane_strain_disp_y_center
+    value2 = slab_disp_y_center
+  []
+  [microrot_z_center_difference]
+    type = RelativeDifferencePostprocessor
+    value1 = plane_strain_microrot_z_center
+    value2 = slab_microrot_z_center
+  []
+  [nonlocal_damage_center_difference]
+    type = RelativeDifferencePostprocessor
+    value1 = plane_strain_nonlocal_damage_center
+    value2 = slab_nonlocal_damage_center
+  []
+  [microrot_z_integral_difference]
+    type = RelativeDifferencePostprocessor
+    value1 = plane_strain_microrot_z_integral
+    value2 = slab_microrot_z_integral
+  []
+  [nonlocal_damage_integral_difference]
+    type = RelativeDifferencePostprocessor
+    value1 = plane_strain_nonlocal_damage_integral
+    value2 = slab_nonlocal_damage_integral
+  []
+[]
+
+[Executioner]
+  type = Transient
+  # the time steps of the sub-apps
+  dt = 1e-1
+  end_time = 1.0
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,216 @@
+# A quarter of the hollow cylinder about the y axis, with symmetry conditions on the planes x = 0
+# and z = 0. Its results, extended to the complete revolution, are the reference of the
+# axisymmetric formulation. The hoop direction is discretized finely, as the second order
+# elements approximate the circumference by chords
+
+[Mesh]
+  [annulus]
+    type = AnnularMeshGenerator
+    nr = 2
+    nt = 12
+    rmin = 50
+    rmax = 100
+    dmin = 0
+    dmax = 90
+  []
+  [extruded]
+    type = AdvancedExtruderGenerator
+    input = annulus
+    direction = '0 0 1'
+    heights = 200
+    num_layers = 4
+    bottom_boundary = 10
+    top_boundary = 11
+  []
+  # the extrusion direction becomes the y axis, and the annulus lies in the plane y = 0 at z <= 0
+  [rotated]
+    type = TransformGenerator
+    input = extruded
+    transform = ROTATE
+    vector_value = '0 90 0'
+  []
+  second_order = true
+[]
+
+[GlobalParams]
+  order = SECOND
+[]
+
+[Variables]
+  [disp_x] []
+  [disp_y] []
+  [disp_z] []
+  [microrot_x] []
+  [microrot_y] []
+  [microrot_z] []
+  [nonlocal_damage] []
+[]
+
+[GradientEnhancedMicropolarContinuum]
+  [all]
+    displacements   = 'disp_x disp_y disp_z'
+    micro_rotations = 'microrot_x microrot_y microrot_z'
+    nonlocal_damage = nonlocal_damage
+    marmot_material_name = GMDRUCKERPRAGER
+                                  # E,          nu,     GcToG,      lb,     lt,     polarRatio,     sigmaYield,
+                                  # hLin,       hExp,   hDeltaExp,  phi(deg),       psi(deg)
+                                  # a1,         a2,     a3,         a4,     lJ2,
+                                  # epsF,       m,      maxDmg,     nonLocalRadius
+    marmot_material_parameters = '  100   0.33    .1          .1      .2       1.4999999      250e-3
+                                    0.2         10       380e-3      20.0     20.0
+                                    0.5         0.0     0.5         0.0     1e10
+                                    1e-0        1.0     0.00        4.0'
+  []
+[]
+
+[Postprocessors]
+  [disp_r_outer]
+    type = PointValue
+    variable = disp_x
+    point = '100 100 0'
+  []
+  [disp_y_outer]
+    type = PointValue
+    variable = disp_y
+    point = '100 150 0'
+  []
+  [microrot_hoop_center]
+    type = PointValue
+    variable = microrot_z
+    point = '75 150 0'
+  []
+  [nonlocal_damage_center]
+    type = PointValue
+    variable = nonlocal_damage
+    point = '75 100 0'
+  []
+  [nonlocal_damage_quarter_integral]
+    type = ElementIntegralVariablePostprocessor
+    variable = nonlocal_damage
+    outputs = none
+  []
+  # over the complete revolution
+  [nonlocal_damage_integral]
+    type = ScalePostprocessor
+    value = nonlocal_damage_quarter_integral
+    scaling_factor = 4
+  []
+[]
+
+[BCs]
+  [bottom_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = 10
+    value = 0
+  []
+  [top_y]
+    type = FunctionDirichletBC
+    variable = disp_y
+    boundary = 11
+    function = '-1.0 * t'
+  []
+  # symmetry about the plane z = 0, where z is the hoop direction
+  [symmetry_z_disp_z]
+    type = DirichletBC
+    variable = disp_z
+    boundary = dmin
+    value = 0
+  []
+  [symmetry_z_microrot_x]
+    type = DirichletBC
+    variable = microrot_x
+    boundary = dmin
+    value = 0
+  []
+  [symmetry_z_microrot_y]
+    type = DirichletBC
+    variable = microrot_y
+    boundary = dmin
+    value = 0
+  []
+  # symmetry about the plane x = 0, where x is the hoop direction
+  [symmetry_x_disp_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = dmax
+    value = 0
+  []
+  [symmetry_x_microrot_y]
+    type = DirichletBC
+    variable = microrot_y
+    boundary = dmax
+    value = 0
+  []
+  [symmetry_x_microrot_z]
+    type = DirichletBC
+    variable = microrot_z
+    boundary = dmax
+    value = 0
+  []
+[]
+
+[Preconditioning]
+  [smp]
+    type = SMP
+    full = true
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+
+  petsc_options_iname = '-pc_type -pc_factor_mat_solver_package'
+  petsc_options_value = ' lu       strumpack'
+
+  nl_rel_tol = 1e-8
+  nl_abs_tol = 1e-10
+  l_tol = 1e-3
+  l_max_its = 250
+  nl_max_its = 20
+  nl_div_tol = 1e2
+
+  automatic_scaling=true
+  compute_scaling_once =true
+  verbose=false
+
+  line_search = none
+
+  dtmin = 1e-4
+  dtmax= 1e-1
+
+  start_time = 0.0
+  end_time = 1.0
+
+  num_steps = 1000
+  [TimeStepper]
+    type = IterationAdaptiveDT
+    optimal_iterations = 15
+    iteration_window = 3
+    linear_iteration_ratio = 1000
+    growth_factor=1.5
+    cutback_factor=0.5
+    dt = 1e-1
+  []
+  [Quadrature]
+    order=SECOND
+  []
+  [Predictor]
+    type = SimplePredictor
+    scale = 1.0
+  []
+[]
+
+[Outputs]
+  interval = 1
+  execute_on = 'initial timestep_end final failed'
+  print_linear_residuals = false
+  csv = true
+  exodus=true
+  [pgraph]
+    type = PerfGraphOutput
+    execute_on = 'final'  # Default is "final"
+    level = 2             # Default is 1
+  []
+[]
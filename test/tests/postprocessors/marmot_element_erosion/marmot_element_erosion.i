@@ -0,0 +1,143 @@
+# The upper element is eroded at the end of the first, unloaded time step. Afterwards, the loading
+# of the top boundary is not transferred to the lower element, and the nodes connected only to the
+# eroded element are kept at their old values
+
+[Mesh]
+  [generated]
+    type = GeneratedMeshGenerator
+    dim = 3
+    nx = 1
+    ny = 2
+    nz = 1
+    xmax = 100
+    ymax = 200
+    zmax = 100
+    elem_type = HEX20
+  []
+  [upper]
+    type = SubdomainBoundingBoxGenerator
+    input = generated
+    bottom_left = '0 100 0'
+    top_right = '100 200 100'
+    block_id = 1
+  []
+[]
+
+[GlobalParams]
+  order = SECOND
+[]
+
+[Variables]
+  [disp_x] []
+  [disp_y] []
+  [disp_z] []
+  [microrot_x] []
+  [microrot_y] []
+  [microrot_z] []
+  [nonlocal_damage] []
+[]
+
+[GradientEnhancedMicropolarContinuum]
+  [all]
+    displacements   = 'disp_x disp_y disp_z'
+    micro_rotations = 'microrot_x microrot_y microrot_z'
+    nonlocal_damage = nonlocal_damage
+    marmot_material_name = GMDRUCKERPRAGER
+    marmot_material_parameters = '  100   0.33    .1          .1      .2       1.4999999      250e-3
+                                    0.2         10       380e-3      20.0     20.0
+                                    0.5         0.0     0.5         0.0     1e10
+                                    1e-0        1.0     0.00        4.0'
+    erosion = erosion
+  []
+[]
+
+[Postprocessors]
+  # every value of the state variables reaches the threshold, so the upper element is eroded at
+  # the end of the first time step
+  [erosion]
+    type = MarmotElementErosion
+    index = 0
+    threshold = -1e100
+    block = 1
+  []
+  [disp_y_top]
+    type = PointValue
+    variable = disp_y
+    point = '0 200 0'
+  []
+  [disp_y_orphaned]
+    type = PointValue
+    variable = disp_y
+    point = '0 150 0'
+  []
+  [disp_y_interface]
+    type = PointValue
+    variable = disp_y
+    point = '0 100 0'
+  []
+[]
+
+[BCs]
+  [bottom_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = bottom
+    value = 0
+  []
+  [bottom_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  []
+  [front_z]
+    type = DirichletBC
+    variable = disp_z
+    boundary = front
+    value = 0
+  []
+  [back_z]
+    type = DirichletBC
+    variable = disp_z
+    boundary = back
+    value = 0
+  []
+  [top_y]
+    type = FunctionDirichletBC
+    variable = disp_y
+    boundary = top
+    function = '-1.0 * max(t - 0.1, 0)'
+  []
+[]
+
+[Preconditioning]
+  [smp]
+    type = SMP
+    full = true
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+
+  petsc_options_iname = '-pc_type -pc_factor_mat_solver_package'
+  petsc_options_value = ' lu       strumpack'
+
+  nl_rel_tol = 1e-8
+  nl_abs_tol = 1e-10
+  nl_max_its = 20
+
+  line_search = none
+
+  dt = 0.1
+  end_time = 0.4
+
+  [Quadrature]
+    order = SECOND
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,172 @@
+# The element averages of entries of the state variables, extracted by ExtractStateVars in a single
+# element loop, must equal the projections of the same entries by MaterialStdVectorAux
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 1
+  ny = 2
+  nz = 1
+  xmax = 100
+  ymax = 200
+  zmax = 100
+  elem_type = HEX20
+[]
+
+[GlobalParams]
+  order = SECOND
+[]
+
+[Variables]
+  [disp_x] []
+  [disp_y] []
+  [disp_z] []
+  [microrot_x] []
+  [microrot_y] []
+  [microrot_z] []
+  [nonlocal_damage] []
+[]
+
+[GradientEnhancedMicropolarContinuum]
+  [all]
+    displacements   = 'disp_x disp_y disp_z'
+    micro_rotations = 'microrot_x microrot_y microrot_z'
+    nonlocal_damage = nonlocal_damage
+    marmot_material_name = GMDRUCKERPRAGER
+    marmot_material_parameters = '  100   0.33    .1          .1      .2       1.4999999      250e-3
+                                    0.2         10       380e-3      20.0     20.0
+                                    0.5         0.0     0.5         0.0     1e10
+                                    1e-0        1.0     0.00        4.0'
+  []
+[]
+
+[AuxVariables]
+  [extracted_0]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [extracted_1]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [projected_0]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [projected_1]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[UserObjects]
+  [extract_state_vars]
+    type = ExtractStateVars
+    variables = 'extracted_0 extracted_1'
+    indices = '0 1'
+    # the extracted values are available to the postprocessors, which are executed after the aux
+    # kernels
+    force_preaux = true
+  []
+[]
+
+[AuxKernels]
+  [projected_0]
+    type = MaterialStdVectorAux
+    variable = projected_0
+    property = state_vars
+    index = 0
+    execute_on = timestep_end
+  []
+  [projected_1]
+    type = MaterialStdVectorAux
+    variable = projected_1
+    property = state_vars
+    index = 1
+    execute_on = timestep_end
+  []
+[]
+
+[Postprocessors]
+  [difference_0]
+    type = ElementL2Difference
+    variable = extracted_0
+    other_variable = projected_0
+  []
+  [difference_1]
+    type = ElementL2Difference
+    variable = extracted_1
+    other_variable = projected_1
+  []
+[]
+
+[BCs]
+  [bottom_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = bottom
+    value = 0
+  []
+  [bottom_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  []
+  [front_z]
+    type = DirichletBC
+    variable = disp_z
+    boundary = front
+    value = 0
+  []
+  [back_z]
+    type = DirichletBC
+    variable = disp_z
+    boundary = back
+    value = 0
+  []
+  [top_y]
+    type = FunctionDirichletBC
+    variable = disp_y
+    boundary = top
+    function = '-1.0 * t'
+  []
+  [top_x]
+    type = FunctionDirichletBC
+    variable = disp_x
+    boundary = top
+    function = '-1.0 * t'
+  []
+[]
+
+[Preconditioning]
+  [smp]
+    type = SMP
+    full = true
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+
+  petsc_options_iname = '-pc_type -pc_factor_mat_solver_package'
+  petsc_options_value = ' lu       strumpack'
+
+  nl_rel_tol = 1e-8
+  nl_abs_tol = 1e-10
+  nl_max_its = 20
+
+  line_search = none
+
+  dt = 0.1
+  end_time = 0.4
+
+  [Quadrature]
+    order = SECOND
+  []
+[]
+
+[Outputs]
+  csv = true
+[]